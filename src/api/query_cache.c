@@ -0,0 +1,329 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CACHE OF QUERY RESULTS
+ */
+
+#include <assert.h>
+
+#include "api/query_cache.h"
+#include "utils/hash_functions.h"
+#include "utils/memalloc.h"
+
+
+/*
+ * Hash code for logic + a[0 ... n-1]
+ */
+static inline uint32_t hash_query(int32_t logic, const term_t *a, uint32_t n) {
+  return jenkins_hash_intarray2(a, n, (uint32_t) logic);
+}
+
+/*
+ * Check whether e's key is logic + a[0 ... n-1]
+ */
+static bool entry_matches(qcache_entry_t *e, int32_t logic, const term_t *a, uint32_t n) {
+  uint32_t i;
+
+  if (e->logic != logic || e->nterms != n) {
+    return false;
+  }
+  for (i=0; i<n; i++) {
+    if (e->data[i] != a[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * Number of bytes used by an entry with n terms and m variables
+ */
+static inline uint64_t entry_bytes(uint32_t n, uint32_t m) {
+  return sizeof(qcache_entry_t) + (n + 2 * (uint64_t) m) * sizeof(int32_t);
+}
+
+static inline uint64_t table_bytes(uint32_t size) {
+  return size * (uint64_t) sizeof(qcache_entry_t *);
+}
+
+
+/*
+ * Initialize: no table yet
+ */
+void init_query_cache(query_cache_t *cache) {
+  cache->data = NULL;
+  cache->size = 0;
+  cache->nelems = 0;
+  cache->resize_threshold = 0;
+  cache->nbytes = 0;
+  cache->max_bytes = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+  init_pvector(&cache->young, 0);
+}
+
+
+/*
+ * Free all entries
+ */
+static void free_entries(query_cache_t *cache) {
+  uint32_t i, n;
+
+  n = cache->size;
+  for (i=0; i<n; i++) {
+    if (cache->data[i] != NULL) {
+      safe_free(cache->data[i]);
+      cache->data[i] = NULL;
+    }
+  }
+  cache->nelems = 0;
+  pvector_reset(&cache->young);
+}
+
+/*
+ * Remove all entries and free the table
+ */
+void reset_query_cache(query_cache_t *cache) {
+  free_entries(cache);
+  safe_free(cache->data);
+  cache->data = NULL;
+  cache->size = 0;
+  cache->resize_threshold = 0;
+  cache->nbytes = 0;
+}
+
+void delete_query_cache(query_cache_t *cache) {
+  reset_query_cache(cache);
+  delete_pvector(&cache->young);
+}
+
+void query_cache_set_limit(query_cache_t *cache, uint64_t n) {
+  cache->max_bytes = n;
+  if (cache->nbytes > n) {
+    reset_query_cache(cache);
+  }
+}
+
+
+/*
+ * Allocate the table
+ */
+static void alloc_table(query_cache_t *cache) {
+  uint32_t i, n;
+
+  assert(cache->data == NULL);
+
+  n = DEF_QCACHE_SIZE;
+  cache->data = (qcache_entry_t **) safe_malloc(n * sizeof(qcache_entry_t *));
+  for (i=0; i<n; i++) {
+    cache->data[i] = NULL;
+  }
+  cache->size = n;
+  cache->nelems = 0;
+  cache->resize_threshold = (uint32_t) (n * QCACHE_RESIZE_RATIO);
+  cache->nbytes = table_bytes(n);
+}
+
+/*
+ * Store e into a clean array data of size mask+1
+ */
+static void clean_copy(qcache_entry_t **data, qcache_entry_t *e, uint32_t mask) {
+  uint32_t j;
+
+  j = e->hash & mask;
+  while (data[j] != NULL) {
+    j ++;
+    j &= mask;
+  }
+  data[j] = e;
+}
+
+/*
+ * Double the table size
+ */
+static void extend_table(query_cache_t *cache) {
+  qcache_entry_t **tmp, *e;
+  uint32_t i, n, n2, mask;
+
+  n = cache->size;
+  n2 = n << 1;
+  if (n2 >= MAX_QCACHE_SIZE) {
+    out_of_memory();
+  }
+
+  tmp = (qcache_entry_t **) safe_malloc(n2 * sizeof(qcache_entry_t *));
+  for (i=0; i<n2; i++) {
+    tmp[i] = NULL;
+  }
+
+  mask = n2 - 1;
+  for (i=0; i<n; i++) {
+    e = cache->data[i];
+    if (e != NULL) {
+      clean_copy(tmp, e, mask);
+    }
+  }
+
+  safe_free(cache->data);
+  cache->data = tmp;
+  cache->size = n2;
+  cache->resize_threshold = (uint32_t) (n2 * QCACHE_RESIZE_RATIO);
+  cache->nbytes += table_bytes(n);
+}
+
+
+/*
+ * Search for logic + a[0 ... n-1]
+ * - h = hash code for logic + a[0 ... n-1]
+ * - return NULL if it's not there
+ */
+static qcache_entry_t *find_entry(query_cache_t *cache, uint32_t h, int32_t logic, const term_t *a, uint32_t n) {
+  qcache_entry_t *e;
+  uint32_t j, mask;
+
+  if (cache->nelems == 0) {
+    return NULL;
+  }
+
+  mask = cache->size - 1;
+  j = h & mask;
+  for (;;) {
+    e = cache->data[j];
+    if (e == NULL || (e->hash == h && entry_matches(e, logic, a, n))) {
+      return e;
+    }
+    j ++;
+    j &= mask;
+  }
+}
+
+qcache_entry_t *query_cache_find(query_cache_t *cache, int32_t logic, const term_t *a, uint32_t n) {
+  qcache_entry_t *e;
+
+  e = find_entry(cache, hash_query(logic, a, n), logic, a, n);
+  if (e == NULL) {
+    cache->misses ++;
+  } else {
+    cache->hits ++;
+  }
+  return e;
+}
+
+
+/*
+ * Add a new entry unless the key is already present
+ */
+void query_cache_add(query_cache_t *cache, int32_t logic, const term_t *a, uint32_t n,
+                     smt_status_t status, const term_t *var, const term_t *map, uint32_t m) {
+  qcache_entry_t *e;
+  uint64_t b;
+  uint32_t i, h;
+
+  assert(status == STATUS_SAT || status == STATUS_UNSAT);
+  assert(status == STATUS_SAT || m == 0);
+
+  if (n >= MAX_QCACHE_ENTRY_SIZE || m >= MAX_QCACHE_ENTRY_SIZE) {
+    return;
+  }
+
+  b = entry_bytes(n, m);
+  if (b + table_bytes(DEF_QCACHE_SIZE) > cache->max_bytes) {
+    // too large or cache disabled
+    return;
+  }
+
+  h = hash_query(logic, a, n);
+  if (find_entry(cache, h, logic, a, n) != NULL) {
+    // added by another thread since our search
+    return;
+  }
+
+  if (cache->nbytes + b > cache->max_bytes ||
+      (cache->nelems + 1 > cache->resize_threshold &&
+       cache->nbytes + b + table_bytes(cache->size) > cache->max_bytes)) {
+    reset_query_cache(cache);
+  }
+
+  if (cache->data == NULL) {
+    alloc_table(cache);
+  } else if (cache->nelems + 1 > cache->resize_threshold) {
+    extend_table(cache);
+  }
+
+  e = (qcache_entry_t *) safe_malloc(b);
+  e->hash = h;
+  e->logic = logic;
+  e->status = status;
+  e->nterms = n;
+  e->nvars = m;
+  for (i=0; i<n; i++) {
+    e->data[i] = a[i];
+  }
+  for (i=0; i<m; i++) {
+    e->data[n + i] = var[i];
+    e->data[n + m + i] = map[i];
+  }
+
+  clean_copy(cache->data, e, cache->size - 1);
+  cache->nelems ++;
+  cache->nbytes += b;
+  pvector_push(&cache->young, e);
+}
+
+
+/*
+ * Mark all terms in entry e
+ */
+static void mark_entry(qcache_entry_t *e, term_table_t *terms) {
+  uint32_t j, n;
+
+  n = e->nterms + 2 * e->nvars;
+  for (j=0; j<n; j++) {
+    term_table_set_gc_mark(terms, index_of(e->data[j]));
+  }
+}
+
+/*
+ * Mark all terms in all entries
+ */
+void query_cache_gc_mark(query_cache_t *cache, term_table_t *terms) {
+  qcache_entry_t *e;
+  uint32_t i;
+
+  for (i=0; i<cache->size; i++) {
+    e = cache->data[i];
+    if (e != NULL) {
+      mark_entry(e, terms);
+    }
+  }
+  pvector_reset(&cache->young);
+}
+
+/*
+ * Mark the terms in the young entries
+ */
+void query_cache_minor_gc_mark(query_cache_t *cache, term_table_t *terms) {
+  uint32_t i, n;
+
+  n = cache->young.size;
+  for (i=0; i<n; i++) {
+    mark_entry(cache->young.data[i], terms);
+  }
+  pvector_reset(&cache->young);
+}
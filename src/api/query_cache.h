@@ -0,0 +1,170 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * CACHE OF QUERY RESULTS
+ */
+
+/*
+ * This is used by yices_check_formulas to answer repeated queries
+ * without calling the solver. A query is a set of Boolean terms
+ * + a logic code. Since terms are hash-consed, two queries that
+ * assert the same formulas (in any order, possibly with duplicates)
+ * are identified by the sorted array of distinct term ids.
+ *
+ * For each query, the cache stores the status (SAT or UNSAT).
+ * For a satisfiable query, it also stores a model as a mapping
+ * from uninterpreted terms to constant terms: var[i] := map[i].
+ *
+ * The memory used is bounded: when adding a new entry would make
+ * the cache exceed its size limit, all entries are removed first.
+ *
+ * The cache does not do any locking. The caller must protect it.
+ */
+
+#ifndef __QUERY_CACHE_H
+#define __QUERY_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "terms/terms.h"
+#include "utils/ptr_vectors.h"
+#include "yices_types.h"
+
+
+/*
+ * Entry:
+ * - hash = hash code of the key
+ * - logic = logic code
+ * - status = STATUS_SAT or STATUS_UNSAT
+ * - nterms = number of terms in the key
+ * - nvars = number of variables in the model
+ * - data[0 ... nterms-1] = key (sorted term ids)
+ * - data[nterms ... nterms + nvars-1] = var array
+ * - data[nterms + nvars ... nterms + 2 nvars - 1] = map array
+ */
+typedef struct qcache_entry_s {
+  uint32_t hash;
+  int32_t logic;
+  smt_status_t status;
+  uint32_t nterms;
+  uint32_t nvars;
+  int32_t data[0]; // real size = nterms + 2 * nvars
+} qcache_entry_t;
+
+#define MAX_QCACHE_ENTRY_SIZE ((UINT32_MAX-sizeof(qcache_entry_t))/(3 * sizeof(int32_t)))
+
+static inline term_t *qcache_entry_vars(qcache_entry_t *e) {
+  return e->data + e->nterms;
+}
+
+static inline term_t *qcache_entry_map(qcache_entry_t *e) {
+  return e->data + e->nterms + e->nvars;
+}
+
+
+/*
+ * Cache:
+ * - data = hash table (open addressing, linear probing)
+ * - size = size of the table (a power of two)
+ * - nelems = number of entries
+ * - resize_threshold = size * QCACHE_RESIZE_RATIO
+ * - nbytes = memory used by the table and the entries
+ * - max_bytes = size limit (0 means that the cache is disabled)
+ * - hits/misses = number of successful and failed lookups
+ * - young = entries added since the last call to query_cache_gc_mark
+ */
+typedef struct query_cache_s {
+  qcache_entry_t **data;
+  uint32_t size;
+  uint32_t nelems;
+  uint32_t resize_threshold;
+  uint64_t nbytes;
+  uint64_t max_bytes;
+  uint64_t hits;
+  uint64_t misses;
+  pvector_t young;
+} query_cache_t;
+
+#define DEF_QCACHE_SIZE 64
+#define MAX_QCACHE_SIZE (UINT32_MAX/sizeof(qcache_entry_t *))
+#define QCACHE_RESIZE_RATIO 0.6
+
+
+/*
+ * Initialize: empty and disabled cache
+ * - the table is allocated on the first addition
+ */
+extern void init_query_cache(query_cache_t *cache);
+
+/*
+ * Delete all entries and the table
+ */
+extern void delete_query_cache(query_cache_t *cache);
+
+/*
+ * Remove all entries (keep the statistics)
+ */
+extern void reset_query_cache(query_cache_t *cache);
+
+/*
+ * Change the size limit to n bytes
+ * - n = 0 disables the cache and removes all entries
+ * - if the cache is larger than n, all entries are removed
+ */
+extern void query_cache_set_limit(query_cache_t *cache, uint64_t n);
+
+static inline bool query_cache_is_enabled(query_cache_t *cache) {
+  return cache->max_bytes > 0;
+}
+
+/*
+ * Search for the entry with the given logic and key a[0 ... n-1]
+ * - a must be sorted and without duplicates
+ * - return NULL if there's no such entry
+ * - update the hit/miss counters
+ */
+extern qcache_entry_t *query_cache_find(query_cache_t *cache, int32_t logic, const term_t *a, uint32_t n);
+
+/*
+ * Add an entry for logic + key a[0 ... n-1]
+ * - status must be STATUS_SAT or STATUS_UNSAT
+ * - the model is given by var[0 ... m-1] and map[0 ... m-1]
+ *   (m must be 0 if status is STATUS_UNSAT)
+ * - nothing is added if there's already an entry for the same key,
+ *   if the cache is disabled, or if the entry alone is larger than
+ *   the size limit
+ */
+extern void query_cache_add(query_cache_t *cache, int32_t logic, const term_t *a, uint32_t n,
+                            smt_status_t status, const term_t *var, const term_t *map, uint32_t m);
+
+/*
+ * Mark all the terms used in the cache entries (for garbage collection)
+ */
+extern void query_cache_gc_mark(query_cache_t *cache, term_table_t *terms);
+
+/*
+ * Mark the terms used in the entries added since the last call to
+ * query_cache_gc_mark or query_cache_minor_gc_mark (for a minor
+ * collection: older entries contain only older terms)
+ */
+extern void query_cache_minor_gc_mark(query_cache_t *cache, term_table_t *terms);
+
+
+#endif /* __QUERY_CACHE_H */
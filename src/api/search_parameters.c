@@ -91,6 +91,9 @@
  * - DEFAULT_AUX_EQ_QUOTA = 100
  * - DEFAULT_ACKERMANN_THRESHOLD = 8
  * - DEFAULT_BOOLACK_THRESHOLD = 8
+ * - DEFAULT_ACK_BUDGET = 100
+ * - DEFAULT_ACK_BUDGET_PERIOD = 0 (no budget)
+ * - DEFAULT_ACK_DECAY_PERIOD = 0 (no decay)
  * - DEFAULT_MAX_INTERFACE_EQS = 200
  *
  * The dynamic ackermann heuristic is disabled for both
@@ -99,6 +102,7 @@
 #define DEFAULT_USE_DYN_ACK           false
 #define DEFAULT_USE_BOOL_DYN_ACK      false
 #define DEFAULT_USE_OPTIMISTIC_FCHECK true
+#define DEFAULT_USE_EXPL_CACHE        false
 #define DEFAULT_AUX_EQ_RATIO          0.3
 
 
@@ -122,6 +126,13 @@
  */
 
 
+/*
+ * Default parameter for the bitvector solver
+ * - lazy bit-blasting is disabled
+ */
+#define DEFAULT_BV_LAZY_WIDTH 0
+
+
 /*
  * All default parameters
  */
@@ -147,12 +158,16 @@ static const param_t default_settings = {
   DEFAULT_USE_DYN_ACK,
   DEFAULT_USE_BOOL_DYN_ACK,
   DEFAULT_USE_OPTIMISTIC_FCHECK,
+  DEFAULT_USE_EXPL_CACHE,
   DEFAULT_MAX_ACKERMANN,
   DEFAULT_MAX_BOOLACKERMANN,
   DEFAULT_AUX_EQ_QUOTA,
   DEFAULT_AUX_EQ_RATIO,
   DEFAULT_ACKERMANN_THRESHOLD,
   DEFAULT_BOOLACK_THRESHOLD,
+  DEFAULT_ACK_BUDGET,
+  DEFAULT_ACK_BUDGET_PERIOD,
+  DEFAULT_ACK_DECAY_PERIOD,
   DEFAULT_MAX_INTERFACE_EQS,
 
   DEFAULT_SIMPLEX_PROP_FLAG,
@@ -164,6 +179,8 @@ static const param_t default_settings = {
 
   DEFAULT_MAX_UPDATE_CONFLICTS,
   DEFAULT_MAX_EXTENSIONALITY,
+
+  DEFAULT_BV_LAZY_WIDTH,
 };
 
 
@@ -203,12 +220,16 @@ typedef enum param_key {
   PARAM_DYN_ACK,
   PARAM_DYN_BOOL_ACK,
   PARAM_OPTIMISTIC_FCHECK,
+  PARAM_CACHE_EXPLANATIONS,
   PARAM_MAX_ACK,
   PARAM_MAX_BOOL_ACK,
   PARAM_AUX_EQ_QUOTA,
   PARAM_AUX_EQ_RATIO,
   PARAM_DYN_ACK_THRESHOLD,
   PARAM_DYN_BOOL_ACK_THRESHOLD,
+  PARAM_DYN_ACK_BUDGET,
+  PARAM_DYN_ACK_BUDGET_PERIOD,
+  PARAM_DYN_ACK_DECAY_PERIOD,
   PARAM_MAX_INTERFACE_EQS,
   // simplex parameters
   PARAM_SIMPLEX_PROP,
@@ -220,9 +241,11 @@ typedef enum param_key {
   // array solver
   PARAM_MAX_UPDATE_CONFLICTS,
   PARAM_MAX_EXTENSIONALITY,
+  // bitvector solver
+  PARAM_BV_LAZY_WIDTH,
 } param_key_t;
 
-#define NUM_PARAM_KEYS (PARAM_MAX_EXTENSIONALITY+1)
+#define NUM_PARAM_KEYS (PARAM_BV_LAZY_WIDTH+1)
 
 // parameter names in lexicographic ordering
 static const char *const param_key_names[NUM_PARAM_KEYS] = {
@@ -230,13 +253,18 @@ static const char *const param_key_names[NUM_PARAM_KEYS] = {
   "aux-eq-ratio",
   "bland-threshold",
   "branching",
+  "bv-lazy-width",
   "c-factor",
   "c-threshold",
+  "cache-explanations",
   "cache-tclauses",
   "clause-decay",
   "d-factor",
   "d-threshold",
   "dyn-ack",
+  "dyn-ack-budget",
+  "dyn-ack-budget-period",
+  "dyn-ack-decay-period",
   "dyn-ack-threshold",
   "dyn-bool-ack",
   "dyn-bool-ack-threshold",
@@ -267,13 +295,18 @@ static const int32_t param_code[NUM_PARAM_KEYS] = {
   PARAM_AUX_EQ_RATIO,
   PARAM_BLAND_THRESHOLD,
   PARAM_BRANCHING,
+  PARAM_BV_LAZY_WIDTH,
   PARAM_C_FACTOR,
   PARAM_C_THRESHOLD,
+  PARAM_CACHE_EXPLANATIONS,
   PARAM_CACHE_TCLAUSES,
   PARAM_CLAUSE_DECAY,
   PARAM_D_FACTOR,
   PARAM_D_THRESHOLD,
   PARAM_DYN_ACK,
+  PARAM_DYN_ACK_BUDGET,
+  PARAM_DYN_ACK_BUDGET_PERIOD,
+  PARAM_DYN_ACK_DECAY_PERIOD,
   PARAM_DYN_ACK_THRESHOLD,
   PARAM_DYN_BOOL_ACK,
   PARAM_DYN_BOOL_ACK_THRESHOLD,
@@ -586,6 +619,10 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     r = set_bool_param(value, &parameters->use_optimistic_fcheck);
     break;
 
+  case PARAM_CACHE_EXPLANATIONS:
+    r = set_bool_param(value, &parameters->use_expl_cache);
+    break;
+
   case PARAM_MAX_ACK:
     r = set_int32_param(value, &z, 1, INT32_MAX);
     if (r == 0) {
@@ -633,6 +670,27 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     }
     break;
 
+  case PARAM_DYN_ACK_BUDGET:
+    r = set_int32_param(value, &z, 0, INT32_MAX);
+    if (r == 0) {
+      parameters->dyn_ack_budget = (uint32_t) z;
+    }
+    break;
+
+  case PARAM_DYN_ACK_BUDGET_PERIOD:
+    r = set_int32_param(value, &z, 0, INT32_MAX);
+    if (r == 0) {
+      parameters->dyn_ack_budget_period = (uint32_t) z;
+    }
+    break;
+
+  case PARAM_DYN_ACK_DECAY_PERIOD:
+    r = set_int32_param(value, &z, 0, INT32_MAX);
+    if (r == 0) {
+      parameters->dyn_ack_decay_period = (uint32_t) z;
+    }
+    break;
+
   case PARAM_MAX_INTERFACE_EQS:
     r = set_int32_param(value, &z, 1, INT32_MAX);
     if (r == 0) {
@@ -684,6 +742,13 @@ int32_t params_set_field(param_t *parameters, const char *key, const char *value
     }
     break;
 
+  case PARAM_BV_LAZY_WIDTH:
+    r = set_int32_param(value, &z, 0, 64);
+    if (r == 0) {
+      parameters->bv_lazy_width = (uint32_t) z;
+    }
+    break;
+
   default:
     assert(k == -1);
     r = -1;
@@ -114,6 +114,8 @@ struct param_s {
    *   for boolean terms
    * - use_optimistic_fcheck: if true, model reconciliation is used
    *   in final_check
+   * - use_expl_cache: if true, the egraph caches the explanations
+   *   of theory equalities until it backtracks (disabled by default)
    *
    * Limits to stop the Ackermann trick if too many lemmas are generated
    * - max_ackermann: limit for the non-boolean version
@@ -128,18 +130,29 @@ struct param_s {
    * Thresholds for generation of Ackermann lemma: no effect unless
    * use_dyn_ack or use_bool_dyn_ack is true.
    *
+   * Optional global budget and decay of the Ackermann heuristics:
+   * - dyn_ack_budget_period: if positive, the total number of Ackermann
+   *   lemmas is bounded by dyn_ack_budget + (number of conflicts)/dyn_ack_budget_period
+   * - dyn_ack_decay_period: if positive, the number of hits for a candidate
+   *   pair is halved every dyn_ack_decay_period conflicts
+   * Both periods are zero by default (no budget and no decay).
+   *
    * Control of interface equality generation: set a limit on
    * the number of interface equalities created per round.
    */
   bool     use_dyn_ack;
   bool     use_bool_dyn_ack;
   bool     use_optimistic_fcheck;
+  bool     use_expl_cache;
   uint32_t max_ackermann;
   uint32_t max_boolackermann;
   uint32_t aux_eq_quota;
   double   aux_eq_ratio;
   uint16_t dyn_ack_threshold;
   uint16_t dyn_bool_ack_threshold;
+  uint32_t dyn_ack_budget;
+  uint32_t dyn_ack_budget_period;
+  uint32_t dyn_ack_decay_period;
   uint32_t max_interface_eqs;
 
 
@@ -170,6 +183,14 @@ struct param_s {
   uint32_t max_update_conflicts;
   uint32_t max_extensionality;
 
+  /*
+   * BITVECTOR SOLVER PARAMETERS
+   * - bv_lazy_width: multiplications, divisions, and remainders of
+   *   bitsize between bv_lazy_width and 64 are bit-blasted on demand
+   *   (0 means that everything is bit-blasted eagerly)
+   */
+  uint32_t bv_lazy_width;
+
 };
 
 
@@ -59,6 +59,7 @@
 #include <unistd.h>
 
 #include "api/context_config.h"
+#include "api/query_cache.h"
 #include "api/search_parameters.h"
 #include "api/yices_error.h"
 #include "api/yices_error_report.h"
@@ -312,6 +313,13 @@ static yices_lock_t generic_list_lock;
 #endif
 
 
+/*
+ * Cache of results for yices_check_formulas
+ * - all accesses are protected by __yices_globals.lock
+ */
+static query_cache_t query_cache;
+
+
 static inline void init_list_locks(void){
 #ifdef THREAD_SAFE
   create_yices_lock(&arith_buffer_list_lock);
@@ -1062,6 +1070,9 @@ EXPORTED void yices_init(void) {
   clear_list(&model_list);
   clear_list(&generic_list);
 
+  // query cache: disabled by default
+  init_query_cache(&query_cache);
+
   // registries for garbage collection
   root_terms = NULL;
   root_types = NULL;
@@ -1102,6 +1113,8 @@ EXPORTED void yices_exit(void) {
   free_model_list();
   free_generic_list();
 
+  delete_query_cache(&query_cache);
+
   delete_list_locks();
 
   q_clear(&r0);
@@ -1193,6 +1206,7 @@ void yices_reset_tables(void) {
   reset_term_table(__yices_globals.terms);
   reset_pprod_table(__yices_globals.pprods);
   reset_type_table(__yices_globals.types);
+  reset_query_cache(&query_cache);
 }
 
 
@@ -8625,6 +8639,88 @@ EXPORTED int32_t yices_assert_formulas(context_t *ctx, uint32_t n, const term_t
 
 
 
+/*
+ * Assert formulas t[0 ... n-1] in ctx and keep the result of preprocessing
+ * so that other contexts can reuse it (see yices_assert_snapshot).
+ * - ctx must be a fresh context: nothing asserted yet, status IDLE
+ *
+ * Error report:
+ * - as in yices_assert_formulas if a term is invalid or not Boolean
+ * - if ctx uses MCSAT or the automatic difference-logic solvers
+ *   code = CTX_OPERATION_NOT_SUPPORTED
+ * - if ctx is not fresh
+ *   code = CTX_INVALID_OPERATION
+ */
+EXPORTED int32_t yices_assert_formulas_with_snapshot(context_t *ctx, uint32_t n, const term_t t[]) {
+  int32_t code;
+
+  if (!yices_assert_formulas_checks(n, t)) {
+    return -1;
+  }
+
+  if (! context_supports_snapshots(ctx)) {
+    error_report_t *error = get_yices_error();
+    error->code = CTX_OPERATION_NOT_SUPPORTED;
+    return -1;
+  }
+
+  if (! context_has_no_assertions(ctx)) {
+    error_report_t *error = get_yices_error();
+    error->code = CTX_INVALID_OPERATION;
+    return -1;
+  }
+
+  code = assert_formulas_with_snapshot(ctx, n, t);
+  if (code < 0) {
+    // error during internalization
+    convert_internalization_error(code);
+    return -1;
+  }
+  assert(code == TRIVIALLY_UNSAT || code == CTX_NO_ERROR);
+
+  return 0;
+}
+
+
+/*
+ * Assert in ctx the formulas preprocessed in src by yices_assert_formulas_with_snapshot
+ * - ctx must be a fresh context with the same configuration as src
+ *
+ * Error report:
+ * - if ctx uses MCSAT or the automatic difference-logic solvers
+ *   code = CTX_OPERATION_NOT_SUPPORTED
+ * - if ctx is not fresh, or src has no snapshot, or ctx and src have
+ *   different configurations
+ *   code = CTX_INVALID_OPERATION
+ */
+EXPORTED int32_t yices_assert_snapshot(context_t *ctx, context_t *src) {
+  int32_t code;
+
+  if (! context_supports_snapshots(ctx)) {
+    error_report_t *error = get_yices_error();
+    error->code = CTX_OPERATION_NOT_SUPPORTED;
+    return -1;
+  }
+
+  if (! context_has_no_assertions(ctx) || ! context_snapshot_compatible(ctx, src)) {
+    error_report_t *error = get_yices_error();
+    error->code = CTX_INVALID_OPERATION;
+    return -1;
+  }
+
+  code = assert_snapshot(ctx, src);
+  if (code < 0) {
+    // error during internalization
+    convert_internalization_error(code);
+    return -1;
+  }
+  assert(code == TRIVIALLY_UNSAT || code == CTX_NO_ERROR);
+
+  return 0;
+}
+
+
+
 /*
  * Add a blocking clause: this is intended to support all-sat and variants.
  * - if ctx's status is SAT or UNKNOWN, then a new clause is added to ctx
@@ -8967,6 +9063,21 @@ EXPORTED smt_status_t yices_check_context_with_assumptions(context_t *ctx, const
 
   assert(context_status(ctx) == STATUS_IDLE);
 
+  // set parameters
+  if (params == NULL) {
+    yices_default_params_for_context(ctx, &default_params);
+    params = &default_params;
+  }
+
+  // the MC-SAT solver takes the assumptions as terms
+  if (context_has_mcsat(ctx)) {
+    stat = check_context_with_term_assumptions(ctx, params, n, a);
+    if (stat == STATUS_INTERRUPTED && context_supports_cleaninterrupt(ctx)) {
+      context_cleanup(ctx);
+    }
+    return stat;
+  }
+
 #ifdef THREADSAFE
   get_yices_lock(&__yices_globals.lock);
 #endif
@@ -8990,12 +9101,6 @@ EXPORTED smt_status_t yices_check_context_with_assumptions(context_t *ctx, const
   release_yices_lock(&__yices_globals.lock);
 #endif
 
-  // set parameters
-  if (params == NULL) {
-    yices_default_params_for_context(ctx, &default_params);
-    params = &default_params;
-  }
-
   // call check
   stat = check_context_with_assumptions(ctx, params, n, assumptions.data);
   if (stat == STATUS_INTERRUPTED && context_supports_cleaninterrupt(ctx)) {
@@ -9290,6 +9395,284 @@ EXPORTED void yices_model_collect_defined_terms(model_t *mdl, term_vector_t *v)
   MT_PROTECT_VOID(__yices_globals.lock, model_get_relevant_vars(mdl, (ivector_t *) v));
 }
 
+/***************************************
+ *  ONE-SHOT CHECKS AND QUERY CACHE    *
+ **************************************/
+
+/*
+ * Get the configuration for yices_check_formulas
+ * - logic = SMT-LIB name of a logic or NULL
+ * - if logic is NULL, the context uses the default solver combination
+ *   (as in yices_new_context(NULL)) but in one-shot mode
+ * - otherwise, the context uses the default configuration for that logic
+ *   in one-shot mode.
+ *
+ * Return false and set the error report if logic is not valid.
+ */
+static bool get_check_formulas_config(const char *logic, smt_logic_t *code, context_arch_t *arch,
+                                      context_mode_t *mode, bool *iflag, bool *qflag) {
+  ctx_config_t config;
+  int32_t k;
+
+  if (logic == NULL) {
+    *code = SMT_UNKNOWN;
+    *arch = CTX_ARCH_EGFUNSPLXBV;
+    *mode = CTX_MODE_ONECHECK;
+    *iflag = true;
+    *qflag = false;
+    return true;
+  }
+
+  init_config_to_defaults(&config);
+  k = config_set_logic(&config, logic);
+  if (k < 0) {
+    error_report_t *error = get_yices_error();
+    if (k == -1) {
+      error->code = CTX_UNKNOWN_LOGIC;
+    } else {
+      error->code = CTX_LOGIC_NOT_SUPPORTED;
+    }
+    return false;
+  }
+
+  k = config_set_field(&config, "mode", "one-shot");
+  assert(k == 0);
+
+  k = decode_config(&config, code, arch, mode, iflag, qflag);
+  if (k < 0) {
+    error_report_t *error = get_yices_error();
+    error->code = CTX_INVALID_CONFIG;
+    return false;
+  }
+
+  return true;
+}
+
+
+/*
+ * Search the cache for logic + key
+ * - if there's an entry, store its status in *stat and return true
+ * - if model is not NULL and the status is SAT, also build
+ *   a new model from the entry and store it in *model
+ */
+static bool _o_find_cached_query(smt_logic_t logic, ivector_t *key, smt_status_t *stat, model_t **model) {
+  qcache_entry_t *e;
+  model_t *mdl;
+  bool found;
+
+  found = false;
+  if (query_cache_is_enabled(&query_cache)) {
+    e = query_cache_find(&query_cache, logic, key->data, key->size);
+    if (e != NULL) {
+      found = true;
+      *stat = e->status;
+      if (model != NULL && e->status == STATUS_SAT) {
+        mdl = yices_new_model(true);
+        build_model_from_map(mdl, e->nvars, qcache_entry_vars(e), qcache_entry_map(e));
+        *model = mdl;
+      }
+    }
+  }
+
+  return found;
+}
+
+static bool find_cached_query(smt_logic_t logic, ivector_t *key, smt_status_t *stat, model_t **model) {
+  MT_PROTECT(bool, __yices_globals.lock, _o_find_cached_query(logic, key, stat, model));
+}
+
+
+/*
+ * Check whether the query cache is enabled
+ */
+static bool _o_query_cache_enabled(void) {
+  return query_cache_is_enabled(&query_cache);
+}
+
+static bool query_cache_enabled(void) {
+  MT_PROTECT(bool, __yices_globals.lock, _o_query_cache_enabled());
+}
+
+
+/*
+ * Store the result of query logic + key in the cache
+ * - stat must be STATUS_SAT or STATUS_UNSAT
+ * - if stat is STATUS_SAT, mdl must be a model of the query
+ * - the model is stored as a mapping from uninterpreted terms to
+ *   constant terms. If that's not possible (e.g., for variables of
+ *   function types), the query is not cached.
+ */
+static void _o_cache_query_result(smt_logic_t logic, ivector_t *key, smt_status_t stat, model_t *mdl) {
+  ivector_t vars;
+  term_t *map;
+  value_t v;
+  term_t t;
+  uint32_t i, n;
+  bool ok;
+
+  init_ivector(&vars, 10);
+  map = NULL;
+  n = 0;
+  ok = true;
+
+  if (stat == STATUS_SAT) {
+    assert(mdl != NULL);
+    model_get_all_vars(mdl, &vars);
+    n = vars.size;
+    map = (term_t *) safe_malloc(n * sizeof(term_t));
+    for (i=0; i<n; i++) {
+      t = vars.data[i];
+      if (is_function_term(__yices_globals.terms, t)) {
+        ok = false;
+        break;
+      }
+      v = model_get_term_value(mdl, t);
+      if (v < 0) {
+        ok = false;
+        break;
+      }
+      t = convert_value_to_term(__yices_globals.terms, model_get_vtbl(mdl), v);
+      if (t < 0) {
+        ok = false;
+        break;
+      }
+      map[i] = t;
+    }
+  }
+
+  if (ok) {
+    query_cache_add(&query_cache, logic, key->data, key->size, stat, vars.data, map, n);
+  }
+
+  safe_free(map);
+  delete_ivector(&vars);
+}
+
+static void cache_query_result(smt_logic_t logic, ivector_t *key, smt_status_t stat, model_t *mdl) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_cache_query_result(logic, key, stat, mdl));
+}
+
+
+/*
+ * Check whether the conjunction of formulas f[0 ... n-1] is satisfiable
+ * - logic = SMT-LIB name of a logic or NULL
+ * - model = optional pointer to a model
+ *
+ * This creates a one-shot context for the given logic, asserts
+ * f[0 ... n-1] in that context, and checks satisfiability using the
+ * default search parameters. If logic is NULL, the default
+ * configuration is used (all solvers).
+ *
+ * If the query cache is enabled (see yices_set_query_cache_size) and
+ * the same formulas (in any order) were checked before for the same
+ * logic, then the result is taken from the cache.
+ *
+ * The function returns the status (STATUS_SAT, STATUS_UNSAT, STATUS_UNKNOWN,
+ * or STATUS_INTERRUPTED) or STATUS_ERROR if something goes wrong.
+ * If the status is STATUS_SAT and model != NULL, a new model is
+ * stored in *model. It must be deleted by the caller.
+ *
+ * Error report:
+ * - as in yices_assert_formulas if one of the f[i] is invalid or not Boolean
+ * - code = CTX_UNKNOWN_LOGIC if logic is not a valid name
+ * - code = CTX_LOGIC_NOT_SUPPORTED if logic is not supported
+ * - other codes as in yices_assert_formulas if f[0 ... n-1] can't be
+ *   asserted in a context for logic
+ */
+EXPORTED smt_status_t yices_check_formulas(const term_t f[], uint32_t n, const char *logic, model_t **model) {
+  smt_logic_t code;
+  context_arch_t arch;
+  context_mode_t mode;
+  bool iflag, qflag, caching;
+  ivector_t key;
+  context_t *ctx;
+  model_t *mdl;
+  smt_status_t stat;
+  int32_t k;
+
+  if (! yices_assert_formulas_checks(n, f) ||
+      ! get_check_formulas_config(logic, &code, &arch, &mode, &iflag, &qflag)) {
+    return STATUS_ERROR;
+  }
+
+  // the cache key: sorted array of distinct terms
+  init_ivector(&key, n);
+  ivector_copy(&key, f, n);
+  ivector_remove_duplicates(&key);
+
+  caching = query_cache_enabled();
+  if (caching && find_cached_query(code, &key, &stat, model)) {
+    delete_ivector(&key);
+    return stat;
+  }
+
+  ctx = yices_create_context(code, arch, mode, iflag, qflag);
+  k = assert_formulas(ctx, key.size, key.data);
+  if (k < 0) {
+    convert_internalization_error(k);
+    stat = STATUS_ERROR;
+  } else {
+    stat = yices_check_context(ctx, NULL);
+  }
+
+  mdl = NULL;
+  if (stat == STATUS_SAT && (caching || model != NULL)) {
+    mdl = yices_get_model(ctx, true);
+  }
+
+  if (caching && (stat == STATUS_SAT || stat == STATUS_UNSAT)) {
+    cache_query_result(code, &key, stat, mdl);
+  }
+
+  if (mdl != NULL) {
+    if (model != NULL) {
+      *model = mdl;
+    } else {
+      yices_free_model(mdl);
+    }
+  }
+
+  yices_free_context(ctx);
+  delete_ivector(&key);
+
+  return stat;
+}
+
+
+/*
+ * Set the size limit of the query cache to nbytes
+ * - nbytes = 0 disables the cache (this is the default)
+ * - if the cache uses more than nbytes, it is emptied
+ */
+static void _o_yices_set_query_cache_size(uint64_t nbytes) {
+  query_cache_set_limit(&query_cache, nbytes);
+}
+
+EXPORTED void yices_set_query_cache_size(uint64_t nbytes) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_set_query_cache_size(nbytes));
+}
+
+
+/*
+ * Query cache statistics:
+ * - hits = number of queries answered from the cache
+ * - misses = number of queries not found in the cache
+ * - entries = number of entries in the cache
+ * - nbytes = memory used by the cache
+ * Any of these pointers can be NULL.
+ */
+static void _o_yices_get_query_cache_stats(uint64_t *hits, uint64_t *misses, uint32_t *entries, uint64_t *nbytes) {
+  if (hits != NULL) *hits = query_cache.hits;
+  if (misses != NULL) *misses = query_cache.misses;
+  if (entries != NULL) *entries = query_cache.nelems;
+  if (nbytes != NULL) *nbytes = query_cache.nbytes;
+}
+
+EXPORTED void yices_get_query_cache_stats(uint64_t *hits, uint64_t *misses, uint32_t *entries, uint64_t *nbytes) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_get_query_cache_stats(hits, misses, entries, nbytes));
+}
+
+
 
 /************************
  *  VALUES IN A MODEL   *
@@ -11011,6 +11394,36 @@ static void model_list_gc_mark(void) {
   }
 }
 
+// minor collection: mark the contexts used since the last collection
+static void context_list_minor_gc_mark(void) {
+  dl_list_t *elem;
+  context_t *ctx;
+
+  elem = context_list.next;
+  while (elem != &context_list) {
+    ctx = context_of_header(elem);
+    if (context_gc_dirty(ctx)) {
+      context_gc_mark(ctx);
+    }
+    elem = elem->next;
+  }
+}
+
+// minor collection: mark the models used since the last collection
+static void model_list_minor_gc_mark(void) {
+  dl_list_t *elem;
+  model_t *mdl;
+
+  elem = model_list.next;
+  while (elem != &model_list) {
+    mdl = model_of_header(elem);
+    if (model_gc_dirty(mdl)) {
+      model_gc_mark(mdl);
+    }
+    elem = elem->next;
+  }
+}
+
 // mark all terms in array a, n = size of a
 static void mark_term_array(term_table_t *tbl, const term_t *a, uint32_t n) {
   uint32_t i;
@@ -11024,6 +11437,22 @@ static void mark_term_array(term_table_t *tbl, const term_t *a, uint32_t n) {
   }
 }
 
+// minor collection: mark the young terms with a positive reference counter
+static void mark_young_root_terms(term_table_t *tbl) {
+  uint32_t i, n;
+  int32_t k;
+
+  assert(root_terms != NULL);
+
+  n = tbl->young.size;
+  for (i=0; i<n; i++) {
+    k = tbl->young.data[i];
+    if (good_term_idx(tbl, k) && sparse_array_read(root_terms, k) > 0) {
+      term_table_set_gc_mark(tbl, k);
+    }
+  }
+}
+
 // mark all types in array a
 static void mark_type_array(type_table_t *tbl, const type_t *a, uint32_t n) {
   uint32_t i;
@@ -11066,6 +11495,7 @@ void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
    */
   context_list_gc_mark();
   model_list_gc_mark();
+  query_cache_gc_mark(&query_cache, __yices_globals.terms);
 
   /*
    * Add roots from t and tau
@@ -11099,3 +11529,60 @@ void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
   release_list_locks();
 
 }
+
+
+/*
+ * Collect the young generation: delete the terms created since the
+ * previous call to the garbage collector that are not reachable from
+ * a root. Older terms and all types are kept.
+ * - t = optional array of terms
+ * - nt = size of t
+ *
+ * The roots are the same as in yices_garbage_collect, plus all
+ * young terms that were given a name. Contexts and models that were
+ * not used since the previous collection are skipped: they can only
+ * refer to old terms. If the young generation is not tracked, this
+ * does a full collection (keeping all named terms).
+ */
+EXPORTED void yices_garbage_collect_young(const term_t t[], uint32_t nt) {
+  MT_PROTECT_VOID(__yices_globals.lock, _o_yices_garbage_collect_young(t, nt));
+}
+
+void _o_yices_garbage_collect_young(const term_t t[], uint32_t nt) {
+  term_table_t *terms;
+
+  terms = __yices_globals.terms;
+  if (! term_table_tracks_young(terms)) {
+    _o_yices_garbage_collect(t, nt, NULL, 0, true);
+    return;
+  }
+
+  get_list_locks();
+
+  term_table_start_minor_gc(terms);
+
+  /*
+   * Default roots: the contexts, models, and cache entries
+   * that may refer to young terms
+   */
+  context_list_minor_gc_mark();
+  model_list_minor_gc_mark();
+  query_cache_minor_gc_mark(&query_cache, terms);
+
+  /*
+   * Roots from t and the reference counting: old terms are not
+   * collected so we just need the young terms whose counter is positive
+   */
+  if (t != NULL) mark_term_array(terms, t, nt);
+  if (root_terms != NULL) {
+    mark_young_root_terms(terms);
+  }
+
+  term_table_minor_gc(terms);
+
+  if (__yices_globals.fvars != NULL) {
+    cleanup_fvar_collector(__yices_globals.fvars);
+  }
+
+  release_list_locks();
+}
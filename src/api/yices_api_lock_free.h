@@ -741,6 +741,8 @@ extern void _o_yices_garbage_collect(const term_t t[], uint32_t nt,
                                      const type_t tau[], uint32_t ntau,
                                      int32_t keep_named);
 
+extern void _o_yices_garbage_collect_young(const term_t t[], uint32_t nt);
+
 
 
 #endif /* ___O_YICES_API_H */
@@ -2480,6 +2480,407 @@ static literal_t map_bit_select_to_literal(context_t *ctx, select_term_t *select
 }
 
 
+/************************************
+ *  POST-ORDER PRE-INTERNALIZATION  *
+ ***********************************/
+
+/*
+ * The internalize_to_xxx functions recurse on the term structure. To bound
+ * the C stack on deep terms (long if-then-else chains, nested bit-vector
+ * sums from unrolled loops, nested function applications), internalize_to_xxx(r)
+ * first internalizes the subterms of r in post-order using ctx->dfs_stack.
+ * When the map_xxx function for r is called, all the children are already
+ * mapped and the recursion stops after one level.
+ *
+ * Each child is internalized by the same internalize_to_xxx function as in
+ * the recursive code, in the same order, with the following exceptions:
+ * - or: we walk the disjuncts that map_or_to_literal would internalize (i.e.,
+ *   after flattening if it's enabled) and we stop at the first disjunct that's
+ *   true.
+ * - arithmetic and egraph if-then-else: as in map_ite_to_arith and map_ite_to_eterm,
+ *   the condition is internalized first and only the selected branch is visited
+ *   if it's true or false. If ite flattening is enabled, we visit the leaves
+ *   that flatten_ite_to_arith/flatten_ite_to_eterm would see. The nested
+ *   conditions are then internalized before the leaves and the leaves before
+ *   the if-then-else variable.
+ * - if-then-else terms that can be converted to a conditional are left to
+ *   the recursive code.
+ *
+ * Atoms and other composites have their own simplification so we leave them
+ * to the recursive code too.
+ */
+
+/*
+ * Each stack element is a pair [t, flag]:
+ * - t is an unmapped root (t may be negative if it's Boolean)
+ * - flag is a combination of the bits below
+ * - if DFS_DISJUNCT is set, flag >> 3 is the stack size before the
+ *   disjuncts were pushed. If t is true, the remaining disjuncts are
+ *   removed by restoring this size.
+ */
+#define DFS_EXPANDED 1   // the children of t are on the stack
+#define DFS_ETERM    2   // t is internalized by internalize_to_eterm
+#define DFS_DISJUNCT 4   // t is a disjunct of an or
+
+
+/*
+ * Check whether the children of root r should be internalized first
+ * - r must be an unmapped, positive root
+ * - eterm is true if r is to be internalized by internalize_to_eterm
+ */
+static bool internalize_subterms_first(context_t *ctx, term_t r, bool eterm) {
+  term_table_t *terms;
+
+  terms = ctx->terms;
+  switch (term_kind(terms, r)) {
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case OR_TERM:
+  case XOR_TERM:
+    return true;
+
+  case EQ_TERM:
+    return is_boolean_term(terms, eq_term_desc(terms, r)->arg[0]);
+
+  case APP_TERM:
+  case TUPLE_TERM:
+  case SELECT_TERM:
+  case UPDATE_TERM:
+    return context_has_egraph(ctx);
+
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV64_POLY:
+  case BV_POLY:
+  case ARITH_POLY:
+  case POWER_PRODUCT:
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+
+/*
+ * Push t's root on the stack if it's not mapped yet
+ */
+static void dfs_push_subterm(context_t *ctx, ivector_t *v, term_t t, int32_t flag) {
+  term_t r;
+
+  r = intern_tbl_get_root(&ctx->intern, t);
+  if (! intern_tbl_root_is_mapped(&ctx->intern, unsigned_term(r))) {
+    ivector_push(v, r);
+    ivector_push(v, flag);
+  }
+}
+
+
+/*
+ * Reverse the order of the pairs in v[i ... v->size-1]
+ */
+static void dfs_reverse_pairs(ivector_t *v, uint32_t i) {
+  uint32_t j;
+  int32_t aux;
+
+  j = v->size;
+  assert(((j - i) & 1) == 0);
+  while (i + 2 < j) {
+    j -= 2;
+    aux = v->data[i]; v->data[i] = v->data[j]; v->data[j] = aux;
+    aux = v->data[i+1]; v->data[i+1] = v->data[j+1]; v->data[j+1] = aux;
+    i += 2;
+  }
+}
+
+
+/*
+ * Push the disjuncts a[0 ... n-1] of an or, in reverse order
+ * - skip them all if disjunct_is_true
+ * - stop at the first disjunct that's already mapped to true
+ */
+static void dfs_push_disjuncts(context_t *ctx, ivector_t *v, term_t *a, uint32_t n, int32_t flag) {
+  uint32_t i;
+  term_t r;
+
+  if (disjunct_is_true(ctx, a, n)) return;
+
+  for (i=0; i<n; i++) {
+    r = intern_tbl_get_root(&ctx->intern, a[i]);
+    if (intern_tbl_root_is_mapped(&ctx->intern, unsigned_term(r)) &&
+        internalize_to_literal(ctx, a[i]) == true_literal) {
+      break;
+    }
+  }
+
+  while (i > 0) {
+    i --;
+    dfs_push_subterm(ctx, v, a[i], flag);
+  }
+}
+
+
+/*
+ * Push the children of (or ...) as in map_or_to_literal
+ */
+static void dfs_push_or(context_t *ctx, ivector_t *v, composite_term_t *or) {
+  ivector_t *a;
+  int32_t flag;
+
+  assert(v->size < (UINT32_MAX >> 3));
+  flag = DFS_DISJUNCT | (int32_t) (v->size << 3);
+
+  if (context_flatten_or_enabled(ctx)) {
+    a = &ctx->aux_vector;
+    assert(a->size == 0);
+    flatten_or_term(ctx, a, or);
+    dfs_push_disjuncts(ctx, v, a->data, a->size, flag);
+    ivector_reset(a);
+  } else {
+    dfs_push_disjuncts(ctx, v, or->arg, or->arity, flag);
+  }
+}
+
+
+/*
+ * Push the children of an arithmetic or egraph if-then-else
+ * as in map_ite_to_arith or map_ite_to_eterm
+ * - flag = flag for the children
+ */
+static void dfs_push_ite_leaves(context_t *ctx, ivector_t *v, composite_term_t *ite, int32_t flag) {
+  ite_flattener_t flattener;
+  conditional_t *d;
+  uint32_t base;
+  literal_t c;
+  term_t x;
+
+  d = context_make_conditional(ctx, ite);
+  if (d != NULL) {
+    // left to map_conditional_to_arith/map_conditional_to_eterm
+    context_free_conditional(ctx, d);
+    return;
+  }
+
+  c = internalize_to_literal(ctx, ite->arg[0]);
+  if (c == true_literal) {
+    dfs_push_subterm(ctx, v, ite->arg[1], flag);
+  } else if (c == false_literal) {
+    dfs_push_subterm(ctx, v, ite->arg[2], flag);
+  } else if (! context_ite_flattening_enabled(ctx)) {
+    dfs_push_subterm(ctx, v, ite->arg[2], flag);
+    dfs_push_subterm(ctx, v, ite->arg[1], flag);
+  } else {
+    // same walk as in flatten_ite_to_arith: push the leaves in order
+    base = v->size;
+    init_ite_flattener(&flattener);
+    ite_flattener_push(&flattener, ite, c);
+
+    while (ite_flattener_is_nonempty(&flattener)) {
+      if (ite_flattener_last_lit_false(&flattener)) {
+        // dead branch
+        ite_flattener_next_branch(&flattener);
+        continue;
+      }
+      assert(ite_flattener_branch_is_live(&flattener));
+
+      x = ite_flattener_leaf(&flattener);
+      x = intern_tbl_get_root(&ctx->intern, x);
+      if (is_pos_term(x) &&
+          is_ite_term(ctx->terms, x) &&
+          !intern_tbl_root_is_mapped(&ctx->intern, x) &&
+          term_is_not_shared(&ctx->sharing, x)) {
+        ite = ite_term_desc(ctx->terms, x);
+        assert(ite->arity == 3);
+        c = internalize_to_literal(ctx, ite->arg[0]);
+        ite_flattener_push(&flattener, ite, c);
+      } else {
+        dfs_push_subterm(ctx, v, x, flag);
+        ite_flattener_next_branch(&flattener);
+      }
+    }
+
+    delete_ite_flattener(&flattener);
+
+    // put the first leaf on top
+    dfs_reverse_pairs(v, base);
+  }
+}
+
+
+/*
+ * Push the children of r in reverse order (so that the first child is on top)
+ * - eterm is true if r is to be internalized by internalize_to_eterm
+ * - for an if-then-else, internalize the condition first
+ */
+static void dfs_push_children(context_t *ctx, ivector_t *v, term_t r, bool eterm) {
+  term_table_t *terms;
+  composite_term_t *c;
+  pprod_t *p;
+  polynomial_t *q;
+  bvpoly64_t *q64;
+  bvpoly_t *qbv;
+  uint32_t i, n, k;
+  literal_t l;
+  type_t tau;
+
+  terms = ctx->terms;
+  switch (term_kind(terms, r)) {
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    c = ite_term_desc(terms, r);
+    tau = term_type(terms, r);
+    if (is_boolean_type(tau) || (!eterm && is_bv_type(ctx->types, tau))) {
+      // as in map_ite_to_literal or map_ite_to_bv
+      l = internalize_to_literal(ctx, c->arg[0]);
+      if (l == true_literal) {
+        dfs_push_subterm(ctx, v, c->arg[1], 0);
+      } else if (l == false_literal) {
+        dfs_push_subterm(ctx, v, c->arg[2], 0);
+      } else {
+        dfs_push_subterm(ctx, v, c->arg[2], 0);
+        dfs_push_subterm(ctx, v, c->arg[1], 0);
+      }
+    } else {
+      dfs_push_ite_leaves(ctx, v, c, eterm ? DFS_ETERM : 0);
+    }
+    break;
+
+  case OR_TERM:
+    dfs_push_or(ctx, v, or_term_desc(terms, r));
+    break;
+
+  case XOR_TERM:
+  case EQ_TERM:
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+    c = composite_term_desc(terms, r);
+    n = c->arity;
+    while (n > 0) {
+      n --;
+      dfs_push_subterm(ctx, v, c->arg[n], 0);
+    }
+    break;
+
+  case APP_TERM:
+  case TUPLE_TERM:
+  case UPDATE_TERM:
+    // map_apply/map_tuple/map_update_to_eterm
+    c = composite_term_desc(terms, r);
+    n = c->arity;
+    while (n > 0) {
+      n --;
+      dfs_push_subterm(ctx, v, c->arg[n], DFS_ETERM);
+    }
+    break;
+
+  case SELECT_TERM:
+    dfs_push_subterm(ctx, v, select_term_desc(terms, r)->arg, DFS_ETERM);
+    break;
+
+  case POWER_PRODUCT:
+    p = pprod_term_desc(terms, r);
+    n = p->len;
+    while (n > 0) {
+      n --;
+      dfs_push_subterm(ctx, v, p->prod[n].var, 0);
+    }
+    break;
+
+  case ARITH_POLY:
+    q = poly_term_desc(terms, r);
+    k = (q->mono[0].var == const_idx); // skip the constant if any
+    for (i=q->nterms; i>k; i--) {
+      dfs_push_subterm(ctx, v, q->mono[i-1].var, 0);
+    }
+    break;
+
+  case BV64_POLY:
+    q64 = bvpoly64_term_desc(terms, r);
+    k = (q64->mono[0].var == const_idx);
+    for (i=q64->nterms; i>k; i--) {
+      dfs_push_subterm(ctx, v, q64->mono[i-1].var, 0);
+    }
+    break;
+
+  case BV_POLY:
+    qbv = bvpoly_term_desc(terms, r);
+    k = (qbv->mono[0].var == const_idx);
+    for (i=qbv->nterms; i>k; i--) {
+      dfs_push_subterm(ctx, v, qbv->mono[i-1].var, 0);
+    }
+    break;
+
+  default:
+    assert(false);
+    break;
+  }
+}
+
+
+/*
+ * Internalize all the subterms of root r in post-order
+ * - r must satisfy internalize_subterms_first(ctx, r, eterm)
+ * - this may be called recursively (e.g., from internalize_to_literal for
+ *   an if-then-else condition) so we only pop what we pushed
+ */
+static void internalize_subterms(context_t *ctx, term_t r, bool eterm) {
+  ivector_t *v;
+  uint32_t base, n;
+  int32_t flag;
+  term_t t;
+
+  v = &ctx->dfs_stack;
+  base = v->size;
+  dfs_push_children(ctx, v, r, eterm);
+
+  while (v->size > base) {
+    n = v->size;
+    t = v->data[n-2];
+    flag = v->data[n-1];
+    r = unsigned_term(t);
+    if (intern_tbl_root_is_mapped(&ctx->intern, r)) {
+      // shared subterm: already internalized
+      ivector_shrink(v, n-2);
+    } else if ((flag & DFS_EXPANDED) == 0 && internalize_subterms_first(ctx, r, flag & DFS_ETERM)) {
+      v->data[n-1] = flag | DFS_EXPANDED;
+      dfs_push_children(ctx, v, r, flag & DFS_ETERM);
+      continue;
+    } else {
+      // all children of r are mapped
+      ivector_shrink(v, n-2);
+      if (flag & DFS_ETERM) {
+        (void) internalize_to_eterm(ctx, r);
+      } else if (is_boolean_term(ctx->terms, r)) {
+        (void) internalize_to_literal(ctx, r);
+      } else if (is_bitvector_term(ctx->terms, r)) {
+        (void) internalize_to_bv(ctx, r);
+      } else {
+        assert(is_arithmetic_term(ctx->terms, r));
+        (void) internalize_to_arith(ctx, r);
+      }
+    }
+
+    if ((flag & DFS_DISJUNCT) && internalize_to_literal(ctx, t) == true_literal) {
+      // the or is true: skip the other disjuncts
+      ivector_shrink(v, ((uint32_t) flag) >> 3);
+    }
+  }
+}
+
+
+
 /****************************************
  *  INTERNALIZATION TO ETERM: TOPLEVEL  *
  ***************************************/
@@ -2535,6 +2936,10 @@ static occ_t internalize_to_eterm(context_t *ctx, term_t t) {
        */
       assert(polarity == 0);
 
+      if (internalize_subterms_first(ctx, r, true)) {
+        internalize_subterms(ctx, r, true);
+      }
+
       switch (term_kind(terms, r)) {
       case CONSTANT_TERM:
         u = pos_occ(make_egraph_constant(ctx, tau, constant_term_index(terms, r)));
@@ -2772,6 +3177,9 @@ static thvar_t internalize_to_arith(context_t *ctx, term_t t) {
      * Compute the internalization
      */
     terms = ctx->terms;
+    if (internalize_subterms_first(ctx, r, false)) {
+      internalize_subterms(ctx, r, false);
+    }
 
     switch (term_kind(terms, r)) {
     case ARITH_CONSTANT:
@@ -2932,6 +3340,9 @@ static thvar_t internalize_to_bv(context_t *ctx, term_t t) {
   } else {
     // compute r's internalization
     terms = ctx->terms;
+    if (internalize_subterms_first(ctx, r, false)) {
+      internalize_subterms(ctx, r, false);
+    }
 
     switch (term_kind(terms, r)) {
     case BV64_CONSTANT:
@@ -3122,6 +3533,10 @@ static literal_t internalize_to_literal(context_t *ctx, term_t t) {
      * Recursively compute r's internalization
      */
     terms = ctx->terms;
+    if (internalize_subterms_first(ctx, r, false)) {
+      internalize_subterms(ctx, r, false);
+    }
+
     switch (term_kind(terms, r)) {
     case CONSTANT_TERM:
       assert(r == true_term);
@@ -5518,6 +5933,7 @@ void init_context(context_t *ctx, term_table_t *terms, smt_logic_t logic,
   init_ivector(&ctx->aux_eqs, CTX_DEFAULT_VECTOR_SIZE);
   init_ivector(&ctx->aux_atoms, CTX_DEFAULT_VECTOR_SIZE);
   init_ivector(&ctx->aux_vector, CTX_DEFAULT_VECTOR_SIZE);
+  init_ivector(&ctx->dfs_stack, CTX_DEFAULT_VECTOR_SIZE);
   init_int_queue(&ctx->queue, 0);
   init_istack(&ctx->istack);
   init_sharing_map(&ctx->sharing, &ctx->intern);
@@ -5532,6 +5948,7 @@ void init_context(context_t *ctx, term_table_t *terms, smt_logic_t logic,
   ctx->eq_cache = NULL;
   ctx->divmod_table = NULL;
   ctx->explorer = NULL;
+  ctx->snapshot = NULL;
 
   ctx->dl_profile = NULL;
   ctx->arith_buffer = NULL;
@@ -5545,6 +5962,7 @@ void init_context(context_t *ctx, term_table_t *terms, smt_logic_t logic,
   init_bvconstant(&ctx->bv_buffer);
 
   ctx->trace = NULL;
+  ctx->gc_dirty = true;
 
   // mcsat options default
   init_mcsat_options(&ctx->mcsat_options);
@@ -5611,6 +6029,7 @@ void delete_context(context_t *ctx) {
   delete_ivector(&ctx->aux_eqs);
   delete_ivector(&ctx->aux_atoms);
   delete_ivector(&ctx->aux_vector);
+  delete_ivector(&ctx->dfs_stack);
   delete_int_queue(&ctx->queue);
   delete_istack(&ctx->istack);
   delete_sharing_map(&ctx->sharing);
@@ -5624,6 +6043,7 @@ void delete_context(context_t *ctx) {
   context_free_eq_cache(ctx);
   context_free_divmod_table(ctx);
   context_free_explorer(ctx);
+  context_free_snapshot(ctx);
 
   context_free_dl_profile(ctx);
   context_free_arith_buffer(ctx);
@@ -5665,6 +6085,7 @@ void reset_context(context_t *ctx) {
   ivector_reset(&ctx->aux_eqs);
   ivector_reset(&ctx->aux_atoms);
   ivector_reset(&ctx->aux_vector);
+  ivector_reset(&ctx->dfs_stack);
   int_queue_reset(&ctx->queue);
   reset_istack(&ctx->istack);
   reset_sharing_map(&ctx->sharing);
@@ -5677,6 +6098,7 @@ void reset_context(context_t *ctx) {
   context_reset_eq_cache(ctx);
   context_reset_divmod_table(ctx);
   context_reset_explorer(ctx);
+  context_free_snapshot(ctx);
 
   context_free_arith_buffer(ctx);
   context_reset_poly_buffer(ctx);
@@ -5756,16 +6178,130 @@ static void context_build_sharing_data(context_t *ctx) {
   sharing_map_add_terms(map, ctx->top_formulas.data, ctx->top_formulas.size);
 }
 
+/*
+ * Internalize and assert all terms in top_interns, top_eqs, top_atoms,
+ * and top_formulas.
+ * - this must be called after preprocessing, from a function that
+ *   catches exceptions (i.e., after setjmp(ctx->env))
+ * - return code: TRIVIALLY_UNSAT or CTX_NO_ERROR
+ */
+static int32_t context_assert_top_vectors(context_t *ctx) {
+  ivector_t *v;
+  uint32_t i, n;
+
+  /*
+   * Sharing
+   */
+  context_build_sharing_data(ctx);
+
+  /*
+   * Notify the core + solver(s)
+   */
+  internalization_start(ctx->core);
+
+  /*
+   * Assert top_eqs, top_atoms, top_formulas, top_interns
+   */
+
+  // first: all terms that are already internalized
+  v = &ctx->top_interns;
+  n = v->size;
+  if (n > 0) {
+    trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" existing terms)\n", n);
+    i = 0;
+    do {
+      assert_toplevel_intern(ctx, v->data[i]);
+      i ++;
+    } while (i < n);
+
+    // one round of propagation
+    if (! base_propagate(ctx->core)) {
+      return TRIVIALLY_UNSAT;
+    }
+  }
+
+  // second: all top-level equalities
+  v = &ctx->top_eqs;
+  n = v->size;
+  if (n > 0) {
+    trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" top-level equalities)\n", n);
+    i = 0;
+    do {
+      assert_toplevel_formula(ctx, v->data[i]);
+      i ++;
+    } while (i < n);
+
+    // one round of propagation
+    if (! base_propagate(ctx->core)) {
+      return TRIVIALLY_UNSAT;
+    }
+  }
+
+  // third: all top-level atoms (other than equalities)
+  v = &ctx->top_atoms;
+  n = v->size;
+  if (n > 0) {
+    trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" top-level atoms)\n", n);
+    i = 0;
+    do {
+      assert_toplevel_formula(ctx, v->data[i]);
+      i ++;
+    } while (i < n);
+
+    // one round of propagation
+    if (! base_propagate(ctx->core)) {
+      return TRIVIALLY_UNSAT;
+    }
+  }
+
+  // last: all non-atomic, formulas
+  v =  &ctx->top_formulas;
+  n = v->size;
+  if (n > 0) {
+    trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" top-level formulas)\n", n);
+    i = 0;
+    do {
+      assert_toplevel_formula(ctx, v->data[i]);
+      i ++;
+    } while (i < n);
+
+    // one round of propagation
+    if (! base_propagate(ctx->core)) {
+      return TRIVIALLY_UNSAT;
+    }
+  }
+
+  return CTX_NO_ERROR;
+}
+
+
+/*
+ * Save the result of preprocessing into snapshot snap
+ * - this must be called after preprocessing and before internalization
+ */
+static void context_save_snapshot(context_t *ctx, context_snapshot_t *snap) {
+  ivector_reset(&snap->intern);
+  intern_tbl_export(&ctx->intern, &snap->intern);
+  ivector_copy(&snap->eqs, ctx->top_eqs.data, ctx->top_eqs.size);
+  ivector_copy(&snap->atoms, ctx->top_atoms.data, ctx->top_atoms.size);
+  ivector_copy(&snap->formulas, ctx->top_formulas.data, ctx->top_formulas.size);
+  ivector_copy(&snap->interns, ctx->top_interns.data, ctx->top_interns.size);
+  snap->unsat = false;
+}
+
+
 /*
  * Flatten and internalize assertions a[0 ... n-1]
  * - all elements a[i] must be valid boolean term in ctx->terms
+ * - if snap is non-NULL, the result of preprocessing is saved in snap
+ *   before internalization. If preprocessing finds the assertions
+ *   unsat, snap->unsat is set to true.
  * - return code:
  *   TRIVIALLY_UNSAT if there's an easy contradiction
  *   CTX_NO_ERROR if the assertions were processed without error
  *   a negative error code otherwise.
  */
-static int32_t _o_context_process_assertions(context_t *ctx, uint32_t n, const term_t *a) {
-  ivector_t *v;
+static int32_t _o_context_process_assertions(context_t *ctx, uint32_t n, const term_t *a, context_snapshot_t *snap) {
   uint32_t i;
   int code;
 
@@ -5876,98 +6412,18 @@ static int32_t _o_context_process_assertions(context_t *ctx, uint32_t n, const t
       break;
     }
 
-    /*
-     * Sharing
-     */
-    context_build_sharing_data(ctx);
-
-    /*
-     * Notify the core + solver(s)
-     */
-    internalization_start(ctx->core);
-
-    /*
-     * Assert top_eqs, top_atoms, top_formulas, top_interns
-     */
-    code = CTX_NO_ERROR;
-
-    // first: all terms that are already internalized
-    v = &ctx->top_interns;
-    n = v->size;
-    if (n > 0) {
-      trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" existing terms)\n", n);
-      i = 0;
-      do {
-        assert_toplevel_intern(ctx, v->data[i]);
-        i ++;
-      } while (i < n);
-
-      // one round of propagation
-      if (! base_propagate(ctx->core)) {
-        code = TRIVIALLY_UNSAT;
-        goto done;
-      }
-    }
-
-    // second: all top-level equalities
-    v = &ctx->top_eqs;
-    n = v->size;
-    if (n > 0) {
-      trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" top-level equalities)\n", n);
-      i = 0;
-      do {
-        assert_toplevel_formula(ctx, v->data[i]);
-        i ++;
-      } while (i < n);
-
-      // one round of propagation
-      if (! base_propagate(ctx->core)) {
-        code = TRIVIALLY_UNSAT;
-        goto done;
-      }
+    if (snap != NULL) {
+      context_save_snapshot(ctx, snap);
     }
 
-    // third: all top-level atoms (other than equalities)
-    v = &ctx->top_atoms;
-    n = v->size;
-    if (n > 0) {
-      trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" top-level atoms)\n", n);
-      i = 0;
-      do {
-        assert_toplevel_formula(ctx, v->data[i]);
-        i ++;
-      } while (i < n);
-
-      // one round of propagation
-      if (! base_propagate(ctx->core)) {
-        code = TRIVIALLY_UNSAT;
-        goto done;
-      }
-    }
-
-    // last: all non-atomic, formulas
-    v =  &ctx->top_formulas;
-    n = v->size;
-    if (n > 0) {
-      trace_printf(ctx->trace, 6, "(asserting  %"PRIu32" top-level formulas)\n", n);
-      i = 0;
-      do {
-        assert_toplevel_formula(ctx, v->data[i]);
-        i ++;
-      } while (i < n);
-
-      // one round of propagation
-      if (! base_propagate(ctx->core)) {
-        code = TRIVIALLY_UNSAT;
-        goto done;
-      }
-    }
+    code = context_assert_top_vectors(ctx);
 
   } else {
     /*
      * Exception: return from longjmp(ctx->env, code);
      */
     ivector_reset(&ctx->aux_vector);
+    ivector_reset(&ctx->dfs_stack);
     reset_istack(&ctx->istack);
     int_queue_reset(&ctx->queue);
     context_free_subst(ctx);
@@ -5978,8 +6434,38 @@ static int32_t _o_context_process_assertions(context_t *ctx, uint32_t n, const t
   return code;
 }
 
-static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term_t *a) {
-  MT_PROTECT(int32_t, __yices_globals.lock, _o_context_process_assertions(ctx, n, a));
+/*
+ * The global lock is held for the whole preprocessing and internalization.
+ * Both read the global term and type tables everywhere, and preprocessing
+ * (flattening, simplification, variable elimination) creates new terms.
+ * These tables are not safe for concurrent readers and writers: a term
+ * created by another thread may reallocate the arrays we are reading.
+ * Contexts in different threads are serialized here, unlike the
+ * arithmetic and bitvector final checks (cf. egraph_final_check).
+ */
+static int32_t context_process_assertions(context_t *ctx, uint32_t n, const term_t *a, context_snapshot_t *snap) {
+  MT_PROTECT(int32_t, __yices_globals.lock, _o_context_process_assertions(ctx, n, a, snap));
+}
+
+
+/*
+ * Cleanup after assertions were found TRIVIALLY_UNSAT
+ */
+static void context_set_trivially_unsat(context_t *ctx) {
+  if (ctx->arch == CTX_ARCH_AUTO_IDL || ctx->arch == CTX_ARCH_AUTO_RDL) {
+    // cleanup: reset arch/config to 'no theory'
+    assert(ctx->arith_solver == NULL && ctx->bv_solver == NULL && ctx->fun_solver == NULL &&
+	   ctx->mode == CTX_MODE_ONECHECK);
+    ctx->arch = CTX_ARCH_NOSOLVERS;
+    ctx->theories = 0;
+    ctx->options = 0;
+  }
+
+  if( smt_status(ctx->core) != STATUS_UNSAT) {
+    // force UNSAT in the core
+    add_empty_clause(ctx->core);
+    ctx->core->status = STATUS_UNSAT;
+  }
 }
 
 
@@ -6001,22 +6487,10 @@ int32_t assert_formulas(context_t *ctx, uint32_t n, const term_t *f) {
          ctx->arch == CTX_ARCH_AUTO_RDL ||
          smt_status(ctx->core) == STATUS_IDLE);
 
-  code = context_process_assertions(ctx, n, f);
+  ctx->gc_dirty = true;
+  code = context_process_assertions(ctx, n, f, NULL);
   if (code == TRIVIALLY_UNSAT) {
-    if (ctx->arch == CTX_ARCH_AUTO_IDL || ctx->arch == CTX_ARCH_AUTO_RDL) {
-      // cleanup: reset arch/config to 'no theory'
-      assert(ctx->arith_solver == NULL && ctx->bv_solver == NULL && ctx->fun_solver == NULL &&
-	     ctx->mode == CTX_MODE_ONECHECK);
-      ctx->arch = CTX_ARCH_NOSOLVERS;
-      ctx->theories = 0;
-      ctx->options = 0;
-    }
-
-    if( smt_status(ctx->core) != STATUS_UNSAT) {
-      // force UNSAT in the core
-      add_empty_clause(ctx->core);
-      ctx->core->status = STATUS_UNSAT;
-    }
+    context_set_trivially_unsat(ctx);
   }
 
   return code;
@@ -6042,6 +6516,137 @@ int32_t assert_formula(context_t *ctx, term_t f) {
 }
 
 
+
+/*
+ * PREPROCESSED SNAPSHOTS
+ */
+
+/*
+ * Check whether ctx's architecture supports snapshots
+ */
+bool context_supports_snapshots(context_t *ctx) {
+  return ctx->mcsat == NULL && ctx->arch != CTX_ARCH_AUTO_IDL && ctx->arch != CTX_ARCH_AUTO_RDL;
+}
+
+
+/*
+ * Check whether ctx is empty: nothing asserted or internalized at base level 0.
+ * The internalization table of an empty context contains only true_term.
+ */
+bool context_has_no_assertions(context_t *ctx) {
+  return ctx->base_level == 0 && context_status(ctx) == STATUS_IDLE &&
+    intern_tbl_num_terms(&ctx->intern) <= index_of(true_term) + 1;
+}
+
+
+/*
+ * Check whether the snapshot saved in src can be used by ctx:
+ * both contexts must have the same configuration.
+ */
+bool context_snapshot_compatible(context_t *ctx, context_t *src) {
+  return src->snapshot != NULL && ctx->mode == src->mode && ctx->arch == src->arch &&
+    ctx->logic == src->logic && ctx->theories == src->theories && ctx->options == src->options;
+}
+
+
+/*
+ * Assert f[0 ... n-1] in ctx and save the result of preprocessing in ctx->snapshot
+ * - ctx must support snapshots and be empty
+ * - the return code is as in assert_formulas
+ * - if the code is negative, no snapshot is kept
+ */
+int32_t assert_formulas_with_snapshot(context_t *ctx, uint32_t n, const term_t *f) {
+  context_snapshot_t *snap;
+  int32_t code;
+
+  assert(context_supports_snapshots(ctx) && context_has_no_assertions(ctx));
+
+  snap = context_get_snapshot(ctx);
+  ivector_reset(&snap->intern);
+  ivector_reset(&snap->eqs);
+  ivector_reset(&snap->atoms);
+  ivector_reset(&snap->formulas);
+  ivector_reset(&snap->interns);
+  snap->unsat = true; // cleared by context_save_snapshot
+
+  ctx->gc_dirty = true;
+  code = context_process_assertions(ctx, n, f, snap);
+  if (code < 0) {
+    context_free_snapshot(ctx);
+  } else if (code == TRIVIALLY_UNSAT) {
+    context_set_trivially_unsat(ctx);
+  }
+
+  return code;
+}
+
+
+/*
+ * Copy the snapshot into ctx then internalize and assert its content
+ */
+static int32_t _o_context_assert_snapshot(context_t *ctx, const context_snapshot_t *snap) {
+  int code;
+
+  if (snap->unsat) {
+    return TRIVIALLY_UNSAT;
+  }
+
+  ivector_reset(&ctx->subst_eqs);
+  ivector_reset(&ctx->aux_eqs);
+  ivector_reset(&ctx->aux_atoms);
+
+  code = setjmp(ctx->env);
+  if (code == 0) {
+    intern_tbl_import(&ctx->intern, snap->intern.data, snap->intern.size);
+    ivector_copy(&ctx->top_eqs, snap->eqs.data, snap->eqs.size);
+    ivector_copy(&ctx->top_atoms, snap->atoms.data, snap->atoms.size);
+    ivector_copy(&ctx->top_formulas, snap->formulas.data, snap->formulas.size);
+    ivector_copy(&ctx->top_interns, snap->interns.data, snap->interns.size);
+
+    code = context_assert_top_vectors(ctx);
+
+  } else {
+    /*
+     * Exception: return from longjmp(ctx->env, code);
+     */
+    ivector_reset(&ctx->aux_vector);
+    ivector_reset(&ctx->dfs_stack);
+    reset_istack(&ctx->istack);
+    int_queue_reset(&ctx->queue);
+  }
+
+  return code;
+}
+
+// same locking as context_process_assertions
+static int32_t context_assert_snapshot(context_t *ctx, const context_snapshot_t *snap) {
+  MT_PROTECT(int32_t, __yices_globals.lock, _o_context_assert_snapshot(ctx, snap));
+}
+
+
+/*
+ * Assert in ctx the formulas saved in src->snapshot
+ * - ctx must be empty and compatible with src
+ * - this skips flattening, variable elimination, and the other
+ *   preprocessing steps: the result is the same as calling
+ *   assert_formulas(ctx, n, f) with the formulas used to build the snapshot.
+ * - the return code is as in assert_formulas
+ */
+int32_t assert_snapshot(context_t *ctx, context_t *src) {
+  int32_t code;
+
+  assert(context_has_no_assertions(ctx) && context_snapshot_compatible(ctx, src));
+
+  ctx->gc_dirty = true;
+  code = context_assert_snapshot(ctx, src->snapshot);
+  if (code == TRIVIALLY_UNSAT) {
+    context_set_trivially_unsat(ctx);
+  }
+
+  return code;
+}
+
+
 /*
  * Convert boolean term t to a literal l in context ctx
  * - t must be a boolean term
@@ -6052,6 +6657,7 @@ int32_t context_internalize(context_t *ctx, term_t t) {
   int code;
   literal_t l;
 
+  ctx->gc_dirty = true;
   ivector_reset(&ctx->top_eqs);
   ivector_reset(&ctx->top_atoms);
   ivector_reset(&ctx->top_formulas);
@@ -6070,6 +6676,7 @@ int32_t context_internalize(context_t *ctx, term_t t) {
      * Clean up
      */
     ivector_reset(&ctx->aux_vector);
+    ivector_reset(&ctx->dfs_stack);
     reset_istack(&ctx->istack);
     int_queue_reset(&ctx->queue);
     context_free_subst(ctx);
@@ -6128,6 +6735,7 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
   uint32_t i;
   int code;
 
+  ctx->gc_dirty = true;
   ivector_reset(&ctx->top_eqs);
   ivector_reset(&ctx->top_atoms);
   ivector_reset(&ctx->top_formulas);
@@ -6237,6 +6845,7 @@ int32_t context_process_formulas(context_t *ctx, uint32_t n, term_t *f) {
      * Exception: return from longjmp(ctx->env, code);
      */
     ivector_reset(&ctx->aux_vector);
+    ivector_reset(&ctx->dfs_stack);
     reset_istack(&ctx->istack);
     int_queue_reset(&ctx->queue);
     context_free_subst(ctx);
@@ -6319,6 +6928,8 @@ void context_clear_unsat(context_t *ctx) {
   if (ctx->mcsat == NULL) {
     smt_clear_unsat(ctx->core);
     assert(smt_base_level(ctx->core) == ctx->base_level);
+  } else {
+    mcsat_clear_unsat(ctx->mcsat);
   }
 }
 
@@ -6393,6 +7004,40 @@ static void ctx_mark_eq(void *aux, const pmap2_rec_t *p) {
 }
 
 
+/*
+ * Mark all terms in vector v
+ */
+static void mark_term_vector(term_table_t *terms, ivector_t *v) {
+  uint32_t i, n;
+
+  n = v->size;
+  for (i=0; i<n; i++) {
+    term_table_set_gc_mark(terms, index_of(v->data[i]));
+  }
+}
+
+/*
+ * Mark all terms and types used by snapshot snap
+ */
+static void context_snapshot_gc_mark(context_t *ctx, context_snapshot_t *snap) {
+  ivector_t *v;
+  uint32_t i, n;
+
+  // the intern quadruples are [i, map[i], type[i], rank[i]]
+  v = &snap->intern;
+  n = v->size;
+  for (i=0; i<n; i += 4) {
+    term_table_set_gc_mark(ctx->terms, v->data[i]);
+    type_table_set_gc_mark(ctx->types, v->data[i+2]);
+  }
+
+  mark_term_vector(ctx->terms, &snap->eqs);
+  mark_term_vector(ctx->terms, &snap->atoms);
+  mark_term_vector(ctx->terms, &snap->formulas);
+  mark_term_vector(ctx->terms, &snap->interns);
+}
+
+
 /*
  * Go through all data structures in ctx and mark all terms and types
  * that they use.
@@ -6407,6 +7052,10 @@ void context_gc_mark(context_t *ctx) {
 
   intern_tbl_gc_mark(&ctx->intern);
 
+  if (ctx->snapshot != NULL) {
+    context_snapshot_gc_mark(ctx, ctx->snapshot);
+  }
+
   // empty all the term vectors to be safe
   ivector_reset(&ctx->top_eqs);
   ivector_reset(&ctx->top_atoms);
@@ -6422,4 +7071,6 @@ void context_gc_mark(context_t *ctx) {
   if (ctx->mcsat != NULL) {
     mcsat_gc_mark(ctx->mcsat);
   }
+
+  ctx->gc_dirty = false;
 }
@@ -134,6 +134,38 @@ extern int32_t assert_formula(context_t *ctx, term_t f);
 extern int32_t assert_formulas(context_t *ctx, uint32_t n, const term_t *f);
 
 
+/*
+ * PREPROCESSED SNAPSHOTS
+ *
+ * A context can save the result of preprocessing its assertions
+ * (simplified top-level formulas and variable substitutions) so that
+ * other contexts with the same configuration can assert the same
+ * formulas without repeating flattening, variable elimination,
+ * symmetry breaking, and conditional-definition analysis.
+ *
+ * - context_supports_snapshots(ctx) is false if ctx uses MCSAT or
+ *   one of the automatic difference-logic architectures
+ * - context_has_no_assertions(ctx) is true if nothing has been
+ *   asserted or internalized in ctx yet
+ * - context_snapshot_compatible(ctx, src) is true if src has a
+ *   snapshot and ctx and src have the same configuration
+ *
+ * assert_formulas_with_snapshot(ctx, n, f) works like assert_formulas
+ * and saves the result of preprocessing in ctx. ctx must support
+ * snapshots and be empty. The snapshot is kept until ctx is reset or
+ * deleted.
+ *
+ * assert_snapshot(ctx, src) asserts in ctx the formulas saved in src.
+ * ctx must be empty and compatible with src. The return code is as in
+ * assert_formulas.
+ */
+extern bool context_supports_snapshots(context_t *ctx);
+extern bool context_has_no_assertions(context_t *ctx);
+extern bool context_snapshot_compatible(context_t *ctx, context_t *src);
+extern int32_t assert_formulas_with_snapshot(context_t *ctx, uint32_t n, const term_t *f);
+extern int32_t assert_snapshot(context_t *ctx, context_t *src);
+
+
 /*
  * Convert boolean term t to a literal l in context ctx
  * - return a negative code if there's an error
@@ -194,6 +226,13 @@ extern smt_status_t check_context(context_t *ctx, const param_t *parameters);
  */
 extern smt_status_t check_context_with_assumptions(context_t *ctx, const param_t *parameters, uint32_t n, const literal_t *a);
 
+/*
+ * Variant for the MC-SAT solver (ctx->mcsat must not be NULL)
+ * - a = array of n Boolean terms = n assumptions
+ * - the return status and unsat core are as above
+ */
+extern smt_status_t check_context_with_term_assumptions(context_t *ctx, const param_t *parameters, uint32_t n, const term_t *a);
+
 
 /*
  * Build a model: the context's status must be STATUS_SAT or STATUS_UNKNOWN
@@ -369,5 +408,13 @@ extern bval_t context_bool_term_value(context_t *ctx, term_t t);
  */
 extern void context_gc_mark(context_t *ctx);
 
+/*
+ * Check whether ctx may refer to terms created since the last call
+ * to context_gc_mark. If not, ctx can be skipped by a minor collection.
+ */
+static inline bool context_gc_dirty(context_t *ctx) {
+  return ctx->gc_dirty;
+}
+
 
 #endif /* __CONTEXT_H */
@@ -1415,237 +1415,202 @@ static void remove_subst_candidate(context_t *ctx, term_t t) {
 
 
 /*
- * Visit t: return true if t is on a cycle.
+ * Child k of term index i in the graph explored by visit
+ * - for an uninterpreted term x, the only child is x's root if x is
+ *   not a root, or the candidate substitution for x otherwise
+ * - return NULL_TERM if i has no child k
  */
-static bool visit(context_t *ctx, term_t t);
-
-static bool visit_composite(context_t *ctx, composite_term_t *c) {
-  uint32_t i, n;
-
-  n = c->arity;
-  for (i=0; i<n; i++) {
-    if (visit(ctx, c->arg[i])) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-static bool visit_pprod(context_t *ctx, pprod_t *p) {
-  uint32_t i, n;
-
-  n = p->len;
-  for (i=0; i<n; i++) {
-    if (visit(ctx, p->prod[i].var)) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-static bool visit_arith_poly(context_t *ctx, polynomial_t *p) {
-  monomial_t *m;
-  uint32_t i, n;
-
-  m = p->mono;
-  n = p->nterms;
-  assert(n > 0);
-  // skip constant marker
-  if (m[0].var == const_idx) {
-    m++;
-    n--;
-  }
-
-  for (i=0; i<n; i++) {
-    if (visit(ctx, m[i].var)) {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-static bool visit_bv_poly(context_t *ctx, bvpoly_t *p) {
-  bvmono_t *m;
-  uint32_t i, n;
-
-  m = p->mono;
-  n = p->nterms;
-  assert(n > 0);
-  // skip constant marker
-  if (m[0].var == const_idx) {
-    m++;
-    n--;
-  }
-
-  for (i=0; i<n; i++) {
-    if (visit(ctx, m[i].var)) {
-      return true;
-    }
-  }
+static term_t visit_child(context_t *ctx, int32_t i, uint32_t k) {
+  term_table_t *terms;
+  composite_term_t *c;
+  pprod_t *p;
+  polynomial_t *q;
+  bvpoly64_t *q64;
+  bvpoly_t *qbv;
+  term_t r;
 
-  return false;
-}
+  terms = ctx->terms;
+  switch (kind_for_idx(terms, i)) {
+  case CONSTANT_TERM:
+  case ARITH_CONSTANT:
+  case BV64_CONSTANT:
+  case BV_CONSTANT:
+  case VARIABLE:
+    return NULL_TERM;
 
+  case UNINTERPRETED_TERM:
+    if (k > 0) return NULL_TERM;
+    r = intern_tbl_get_root(&ctx->intern, pos_term(i));
+    if (r == pos_term(i)) {
+      r = subst_candidate(ctx, r);
+    }
+    return r;
+
+  case ARITH_EQ_ATOM:
+  case ARITH_GE_ATOM:
+  case ARITH_IS_INT_ATOM:
+  case ARITH_FLOOR:
+  case ARITH_CEIL:
+  case ARITH_ABS:
+    return (k == 0) ? integer_value_for_idx(terms, i) : NULL_TERM;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+  case APP_TERM:
+  case UPDATE_TERM:
+  case TUPLE_TERM:
+  case EQ_TERM:
+  case DISTINCT_TERM:
+  case FORALL_TERM:
+  case LAMBDA_TERM:
+  case OR_TERM:
+  case XOR_TERM:
+  case ARITH_BINEQ_ATOM:
+  case ARITH_RDIV:
+  case ARITH_IDIV:
+  case ARITH_MOD:
+  case ARITH_DIVIDES_ATOM:
+  case BV_ARRAY:
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+  case BV_EQ_ATOM:
+  case BV_GE_ATOM:
+  case BV_SGE_ATOM:
+    c = composite_for_idx(terms, i);
+    return (k < c->arity) ? c->arg[k] : NULL_TERM;
+
+  case SELECT_TERM:
+  case BIT_TERM:
+    return (k == 0) ? select_for_idx(terms, i)->arg : NULL_TERM;
+
+  case POWER_PRODUCT:
+    p = pprod_for_idx(terms, i);
+    return (k < p->len) ? p->prod[k].var : NULL_TERM;
+
+  // for polynomials: skip the constant marker
+  case ARITH_POLY:
+    q = polynomial_for_idx(terms, i);
+    if (q->mono[0].var == const_idx) k ++;
+    return (k < q->nterms) ? q->mono[k].var : NULL_TERM;
 
-static bool visit_bv64_poly(context_t *ctx, bvpoly64_t *p) {
-  bvmono64_t *m;
-  uint32_t i, n;
+  case BV64_POLY:
+    q64 = bvpoly64_for_idx(terms, i);
+    if (q64->mono[0].var == const_idx) k ++;
+    return (k < q64->nterms) ? q64->mono[k].var : NULL_TERM;
 
-  m = p->mono;
-  n = p->nterms;
-  assert(n > 0);
-  // skip constant marker
-  if (m[0].var == const_idx) {
-    m++;
-    n--;
-  }
+  case BV_POLY:
+    qbv = bvpoly_for_idx(terms, i);
+    if (qbv->mono[0].var == const_idx) k ++;
+    return (k < qbv->nterms) ? qbv->mono[k].var : NULL_TERM;
 
-  for (i=0; i<n; i++) {
-    if (visit(ctx, m[i].var)) {
-      return true;
-    }
+  case UNUSED_TERM:
+  case RESERVED_TERM:
+  default:
+    assert(false);
+    longjmp(ctx->env, INTERNAL_ERROR);
+    break;
   }
 
-  return false;
+  return NULL_TERM;
 }
 
 
+/*
+ * Visit t: return true if t is on a cycle.
+ * - depth-first search using ctx->dfs_stack
+ * - each stack element is a pair [i, k] where i is a grey term index
+ *   and k is the index of the next child of i to visit
+ * - result is the result of the last visit that completed
+ *
+ * When a term x := u is on a cycle, the substitution is removed.
+ * Otherwise, a term is on a cycle if one of its children is. Terms
+ * on a cycle are reset to WHITE. Terms not on a cycle are marked BLACK.
+ */
 static bool visit(context_t *ctx, term_t t) {
-  term_table_t *terms;
-  term_t r;
+  ivector_t *v;
+  uint32_t base, n, k;
   int32_t i;
+  term_t u;
   bool result;
   uint8_t color;
 
   assert(ctx->marks != NULL);
   i = index_of(t);
   color = mark_vector_get_mark(ctx->marks, i);
-
-  if (color == WHITE) {
+  if (color != WHITE) {
     /*
-     * i not visited yet
+     * i already visited before
+     * - if it's black there's no cycle
+     * - if it's grey, we've just detected a cycle
      */
-    terms = ctx->terms;
-    mark_vector_add_mark(ctx->marks, i, GREY);
+    assert(color == GREY || color == BLACK);
+    return color == GREY;
+  }
 
-    switch (kind_for_idx(terms, i)) {
-    case CONSTANT_TERM:
-    case ARITH_CONSTANT:
-    case BV64_CONSTANT:
-    case BV_CONSTANT:
-    case VARIABLE:
-      result = false;
-      break;
+  v = &ctx->dfs_stack;
+  base = v->size;
+  mark_vector_add_mark(ctx->marks, i, GREY);
+  ivector_push(v, i);
+  ivector_push(v, 0);
+  result = false;
 
-    case UNINTERPRETED_TERM:
-      r = intern_tbl_get_root(&ctx->intern, t);
-      if (r != t) {
-        result = visit(ctx, r);
-      } else {
-        r = subst_candidate(ctx, pos_term(i));
-        if (r != NULL_TERM && visit(ctx, r)) {
-          /*
-           * There's a cycle u --> ... --> t := r --> ... --> u
-           * remove the substitution t := r to break the cycle
-           */
-          remove_subst_candidate(ctx, pos_term(i));
-        }
+  while (v->size > base) {
+    n = v->size;
+    i = v->data[n-2];
+    k = v->data[n-1];
+
+    if (k > 0 && result) {
+      // the last child visited is on a cycle
+      if (kind_for_idx(ctx->terms, i) == UNINTERPRETED_TERM &&
+          intern_tbl_get_root(&ctx->intern, pos_term(i)) == pos_term(i)) {
+        /*
+         * There's a cycle u --> ... --> t := r --> ... --> u
+         * remove the substitution t := r to break the cycle
+         */
+        remove_subst_candidate(ctx, pos_term(i));
         result = false;
       }
-      break;
-
-    case ARITH_EQ_ATOM:
-    case ARITH_GE_ATOM:
-    case ARITH_IS_INT_ATOM:
-    case ARITH_FLOOR:
-    case ARITH_CEIL:
-    case ARITH_ABS:
-      result = visit(ctx, integer_value_for_idx(terms, i));
-      break;
-
-    case ITE_TERM:
-    case ITE_SPECIAL:
-    case APP_TERM:
-    case UPDATE_TERM:
-    case TUPLE_TERM:
-    case EQ_TERM:
-    case DISTINCT_TERM:
-    case FORALL_TERM:
-    case LAMBDA_TERM:
-    case OR_TERM:
-    case XOR_TERM:
-    case ARITH_BINEQ_ATOM:
-    case ARITH_RDIV:
-    case ARITH_IDIV:
-    case ARITH_MOD:
-    case ARITH_DIVIDES_ATOM:
-    case BV_ARRAY:
-    case BV_DIV:
-    case BV_REM:
-    case BV_SDIV:
-    case BV_SREM:
-    case BV_SMOD:
-    case BV_SHL:
-    case BV_LSHR:
-    case BV_ASHR:
-    case BV_EQ_ATOM:
-    case BV_GE_ATOM:
-    case BV_SGE_ATOM:
-      result = visit_composite(ctx, composite_for_idx(terms, i));
-      break;
-
-    case SELECT_TERM:
-    case BIT_TERM:
-      result = visit(ctx, select_for_idx(terms, i)->arg);
-      break;
-
-    case POWER_PRODUCT:
-      result = visit_pprod(ctx, pprod_for_idx(terms, i));
-      break;
-
-    case ARITH_POLY:
-      result = visit_arith_poly(ctx, polynomial_for_idx(terms, i));
-      break;
-
-    case BV64_POLY:
-      result = visit_bv64_poly(ctx, bvpoly64_for_idx(terms, i));
-      break;
+      goto done;
+    }
 
-    case BV_POLY:
-      result = visit_bv_poly(ctx, bvpoly_for_idx(terms, i));
-      break;
+    u = visit_child(ctx, i, k);
+    if (u == NULL_TERM) {
+      result = false;
+      goto done;
+    }
 
-    case UNUSED_TERM:
-    case RESERVED_TERM:
-    default:
-      assert(false);
-      longjmp(ctx->env, INTERNAL_ERROR);
-      break;
+    v->data[n-1] = k+1;
+    i = index_of(u);
+    color = mark_vector_get_mark(ctx->marks, i);
+    if (color == WHITE) {
+      mark_vector_add_mark(ctx->marks, i, GREY);
+      ivector_push(v, i);
+      ivector_push(v, 0);
+    } else {
+      assert(color == GREY || color == BLACK);
+      result = (color == GREY);
     }
+    continue;
 
+  done:
     if (result) {
       /*
-       * t is on a cycle of grey terms:
-       *  v --> .. x := u --> ... --> t --> ... --> v
+       * i is on a cycle of grey terms:
+       *  v --> .. x := u --> ... --> i --> ... --> v
        * all terms on the cycle must be cleared except v
        */
       mark_vector_add_mark(ctx->marks, i, WHITE);
     } else {
-      // no cycle containing t: mark i black
+      // no cycle containing i: mark i black
       mark_vector_add_mark(ctx->marks, i, BLACK);
     }
-
-  } else {
-    /*
-     * i already visited before
-     * - if it's black there's no cycle
-     * - if it's grey, we've just detected a cycle
-     */
-    assert(color == GREY || color == BLACK);
-    result = (color == GREY);
+    ivector_shrink(v, n-2);
   }
 
   return result;
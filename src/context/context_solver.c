@@ -32,6 +32,7 @@
 #include "context/context.h"
 #include "context/internalization_codes.h"
 #include "model/models.h"
+#include "solvers/bv/bvsolver.h"
 #include "solvers/cdcl/delegate.h"
 #include "solvers/funs/fun_solver.h"
 #include "solvers/simplex/simplex.h"
@@ -503,6 +504,11 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
     } else {
       egraph_disable_optimistic_final_check(egraph);
     }
+    if (params->use_expl_cache) {
+      egraph_enable_explanation_cache(egraph);
+    } else {
+      egraph_disable_explanation_cache(egraph);
+    }
     if (params->use_dyn_ack) {
       egraph_enable_dyn_ackermann(egraph, params->max_ackermann);
       egraph_set_ackermann_threshold(egraph, params->dyn_ack_threshold);
@@ -515,6 +521,8 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
     } else {
       egraph_disable_dyn_boolackermann(egraph);
     }
+    egraph_set_ackermann_budget(egraph, params->dyn_ack_budget, params->dyn_ack_budget_period);
+    egraph_set_ackermann_decay_period(egraph, params->dyn_ack_decay_period);
     quota = egraph_num_terms(egraph) * params->aux_eq_ratio;
     if (quota < params->aux_eq_quota) {
       quota = params->aux_eq_quota;
@@ -550,15 +558,23 @@ static void context_set_search_parameters(context_t *ctx, const param_t *params)
     fun_solver_set_max_update_conflicts(fsolver, params->max_update_conflicts);
     fun_solver_set_max_extensionality(fsolver, params->max_extensionality);
   }
+
+  /*
+   * Set bitvector solver parameters
+   */
+  if (context_has_bv_solver(ctx)) {
+    bv_solver_set_lazy_blasting(ctx->bv_solver, params->bv_lazy_width);
+  }
 }
 
-static smt_status_t _o_call_mcsat_solver(context_t *ctx, const param_t *params) {
-  mcsat_solve(ctx->mcsat, params);
+static smt_status_t _o_call_mcsat_solver(context_t *ctx, const param_t *params, uint32_t n, const term_t *a) {
+  mcsat_solve(ctx->mcsat, params, n, a);
   return mcsat_status(ctx->mcsat);
 }
 
-static smt_status_t call_mcsat_solver(context_t *ctx, const param_t *params) {
-  MT_PROTECT(smt_status_t, __yices_globals.lock, _o_call_mcsat_solver(ctx, params));
+static smt_status_t call_mcsat_solver(context_t *ctx, const param_t *params, uint32_t n, const term_t *a) {
+  ctx->gc_dirty = true;
+  MT_PROTECT(smt_status_t, __yices_globals.lock, _o_call_mcsat_solver(ctx, params, n, a));
 }
 
 /*
@@ -570,9 +586,10 @@ smt_status_t check_context(context_t *ctx, const param_t *params) {
   smt_status_t stat;
 
   if (ctx->mcsat != NULL) {
-    return call_mcsat_solver(ctx, params);
+    return call_mcsat_solver(ctx, params, 0, NULL);
   }
 
+  ctx->gc_dirty = true;
   core = ctx->core;
   stat = smt_status(core);
   if (stat == STATUS_IDLE) {
@@ -594,8 +611,9 @@ smt_status_t check_context_with_assumptions(context_t *ctx, const param_t *param
   smt_core_t *core;
   smt_status_t stat;
 
-  assert(ctx->mcsat == NULL); // MC-SAT doesn't support assumptions yet
+  assert(ctx->mcsat == NULL); // MC-SAT assumptions are terms (see below)
 
+  ctx->gc_dirty = true;
   core = ctx->core;
   stat = smt_status(core);
   if (stat == STATUS_IDLE) {
@@ -609,6 +627,16 @@ smt_status_t check_context_with_assumptions(context_t *ctx, const param_t *param
 }
 
 
+/*
+ * Check with assumptions a[0] ... a[n-1] given as Boolean terms
+ * - this is the MC-SAT variant: the solver decides the assumptions
+ *   before anything else
+ */
+smt_status_t check_context_with_term_assumptions(context_t *ctx, const param_t *params, uint32_t n, const term_t *a) {
+  assert(ctx->mcsat != NULL);
+  return call_mcsat_solver(ctx, params, n, a);
+}
+
 
 /*
  * Precheck: force generation of clauses and other stuff that's
@@ -633,6 +661,7 @@ smt_status_t precheck_context(context_t *ctx) {
   smt_status_t stat;
   smt_core_t *core;
 
+  ctx->gc_dirty = true;
   core = ctx->core;
 
   stat = smt_status(core);
@@ -670,6 +699,7 @@ smt_status_t check_with_delegate(context_t *ctx, const char *sat_solver, uint32_
   bvar_t x;
   bval_t v;
 
+  ctx->gc_dirty = true;
   core = ctx->core;
 
   stat = smt_status(core);
@@ -903,6 +933,8 @@ void context_build_model(model_t *model, context_t *ctx) {
 
   assert(smt_status(ctx->core) == STATUS_SAT || smt_status(ctx->core) == STATUS_UNKNOWN || mcsat_status(ctx->mcsat) == STATUS_SAT);
 
+  ctx->gc_dirty = true;
+
   /*
    * First build assignments in the satellite solvers
    * and get the val_in_model functions for the egraph
@@ -1013,6 +1045,13 @@ void context_build_unsat_core(context_t *ctx, ivector_t *v) {
   uint32_t i, n;
   term_t t;
 
+  if (ctx->mcsat != NULL) {
+    // the MC-SAT core is already a set of terms
+    ctx->gc_dirty = true;
+    mcsat_build_unsat_core(ctx->mcsat, v);
+    return;
+  }
+
   core = ctx->core;
   assert(core != NULL && core->status == STATUS_UNSAT);
   build_unsat_core(core, v);
@@ -78,6 +78,8 @@ static void show_egraph_stats(FILE *f, egraph_stats_t *stat) {
   fprintf(f, " other dyn ack.lemmas    : %"PRIu32"\n", stat->ack_lemmas);
   fprintf(f, " final checks            : %"PRIu32"\n", stat->final_checks);
   fprintf(f, " interface equalities    : %"PRIu32"\n", stat->interface_eqs);
+  fprintf(f, " cached th. explanations : %"PRIu32"\n", stat->th_expl_hits);
+  fprintf(f, " built th. explanations  : %"PRIu32"\n", stat->th_expl_misses);
 }
 
 /*
@@ -158,6 +160,8 @@ static void show_bvsolver_stats(FILE *f, bv_solver_t *solver) {
   fprintf(f, " equiv conflicts         : %"PRIu32"\n", solver->stats.equiv_conflicts);
   fprintf(f, " semi-equiv lemmas       : %"PRIu32"\n", solver->stats.half_equiv_lemmas);
   fprintf(f, " interface lemmas        : %"PRIu32"\n", solver->stats.interface_lemmas);
+  fprintf(f, " lazy mul/div vars       : %"PRIu32"\n", solver->stats.lazy_vars);
+  fprintf(f, " lazy refinements        : %"PRIu32"\n", solver->stats.lazy_refinements);
 }
 
 
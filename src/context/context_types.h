@@ -626,6 +626,32 @@ typedef struct dl_data_s {
 
 
 
+/***************************
+ *  PREPROCESSED SNAPSHOT  *
+ **************************/
+
+/*
+ * Result of preprocessing a set of assertions, kept so that other
+ * contexts with the same configuration can skip the preprocessing:
+ * - intern = content of the internalization table after preprocessing
+ *   (substitutions and terms mapped to true or false) stored as
+ *   quadruples [i, map[i], type[i], rank[i]]
+ * - eqs, atoms, formulas, interns = copies of the vectors
+ *   top_eqs, top_atoms, top_formulas, top_interns
+ * - unsat = true if preprocessing showed the assertions to be unsat
+ */
+typedef struct context_snapshot_s {
+  ivector_t intern;
+  ivector_t eqs;
+  ivector_t atoms;
+  ivector_t formulas;
+  ivector_t interns;
+  bool unsat;
+} context_snapshot_t;
+
+
+
+
 /**************
  *  CONTEXT   *
  *************/
@@ -678,6 +704,7 @@ struct context_s {
   ivector_t aux_eqs;
   ivector_t aux_atoms;
   ivector_t aux_vector;
+  ivector_t dfs_stack;
   int_queue_t queue;
   int_stack_t istack;
 
@@ -700,6 +727,9 @@ struct context_s {
   divmod_tbl_t *divmod_table;
   bfs_explorer_t *explorer;
 
+  // preprocessed assertions (optional)
+  context_snapshot_t *snapshot;
+
   // buffer to store difference-logic data
   dl_data_t *dl_profile;
 
@@ -724,6 +754,10 @@ struct context_s {
 
   // options for the mcsat solver
   mcsat_options_t mcsat_options;
+
+  // true if the context may refer to terms created since the last call
+  // to context_gc_mark (i.e., it was used since the last collection)
+  bool gc_dirty;
 };
 
 
@@ -638,6 +638,51 @@ void context_record_div(context_t *ctx, thvar_t x, const rational_t *k, thvar_t
  * FACTORING OF DISJUNCTS
  */
 
+/*
+ * PREPROCESSED SNAPSHOT
+ */
+
+/*
+ * Return the snapshot. Allocate and initialize it if needed.
+ */
+context_snapshot_t *context_get_snapshot(context_t *ctx) {
+  context_snapshot_t *tmp;
+
+  tmp = ctx->snapshot;
+  if (tmp == NULL) {
+    tmp = (context_snapshot_t *) safe_malloc(sizeof(context_snapshot_t));
+    init_ivector(&tmp->intern, 0);
+    init_ivector(&tmp->eqs, 0);
+    init_ivector(&tmp->atoms, 0);
+    init_ivector(&tmp->formulas, 0);
+    init_ivector(&tmp->interns, 0);
+    tmp->unsat = false;
+    ctx->snapshot = tmp;
+  }
+
+  return tmp;
+}
+
+
+/*
+ * Free the snapshot if it's not NULL
+ */
+void context_free_snapshot(context_t *ctx) {
+  context_snapshot_t *tmp;
+
+  tmp = ctx->snapshot;
+  if (tmp != NULL) {
+    delete_ivector(&tmp->intern);
+    delete_ivector(&tmp->eqs);
+    delete_ivector(&tmp->atoms);
+    delete_ivector(&tmp->formulas);
+    delete_ivector(&tmp->interns);
+    safe_free(tmp);
+    ctx->snapshot = NULL;
+  }
+}
+
+
 /*
  * Return the explorer data structure
  * - allocate and initialize it if needed
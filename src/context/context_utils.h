@@ -239,6 +239,24 @@ extern void context_record_div(context_t *ctx, thvar_t x, const rational_t *k, t
 
 
 
+/*
+ * PREPROCESSED SNAPSHOT
+ */
+
+/*
+ * Return the snapshot: allocate and initialize it if needed
+ * (the new snapshot is empty)
+ */
+extern context_snapshot_t *context_get_snapshot(context_t *ctx);
+
+/*
+ * Free the snapshot if it's not NULL
+ */
+extern void context_free_snapshot(context_t *ctx);
+
+
+
+
 /*
  * FACTORING OF DISJUNCTS
  */
@@ -747,6 +747,48 @@ void intern_tbl_merge_classes(intern_tbl_t *tbl, term_t r1, term_t r2) {
 
 
 
+/*
+ * COPY
+ */
+
+/*
+ * Copy the content of tbl into v
+ */
+void intern_tbl_export(intern_tbl_t *tbl, ivector_t *v) {
+  uint32_t i, n;
+
+  n = tbl->type.top;
+  for (i=0; i<n; i++) {
+    if (tbl->type.map[i] != NULL_TYPE) {
+      ivector_push(v, i);
+      ivector_push(v, ai32_read(&tbl->map, i));
+      ivector_push(v, ai32_read(&tbl->type, i));
+      ivector_push(v, au8_read(&tbl->rank, i));
+    }
+  }
+}
+
+
+/*
+ * Load quadruples [i, map[i], type[i], rank[i]] into tbl
+ */
+void intern_tbl_import(intern_tbl_t *tbl, const int32_t *a, uint32_t n) {
+  uint32_t k;
+  int32_t i;
+
+  assert((n & 3) == 0);
+
+  for (k=0; k<n; k += 4) {
+    i = a[k];
+    assert(good_term_idx(tbl->terms, i));
+    ai32_write(&tbl->map, i, a[k+1]);
+    ai32_write(&tbl->type, i, a[k+2]);
+    au8_write(&tbl->rank, i, (uint8_t) a[k+3]);
+  }
+}
+
+
+
 /*
  * SUPPORT FOR GARBAGE COLLECTION
  */
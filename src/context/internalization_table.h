@@ -90,6 +90,7 @@
 #include "utils/backtrack_arrays.h"
 #include "utils/int_hash_sets.h"
 #include "utils/int_queues.h"
+#include "utils/int_vectors.h"
 
 
 /*
@@ -324,6 +325,27 @@ extern void intern_tbl_add_subst(intern_tbl_t *tbl, term_t r1, term_t r2);
 extern void intern_tbl_merge_classes(intern_tbl_t *tbl, term_t r1, term_t r2);
 
 
+/*
+ * COPY
+ */
+
+/*
+ * Store the content of tbl into vector v
+ * - every term index i present in tbl is added to v as a quadruple
+ *   [i, map[i], type[i], rank[i]]
+ */
+extern void intern_tbl_export(intern_tbl_t *tbl, ivector_t *v);
+
+/*
+ * Write the quadruples a[0 ... n-1] (as produced by intern_tbl_export) into tbl
+ * - n must be a multiple of 4
+ * - tbl and the source table must use the same term table
+ * - existing entries of tbl for the same indices are overwritten
+ */
+extern void intern_tbl_import(intern_tbl_t *tbl, const int32_t *a, uint32_t n);
+
+
+
 /*
  * SUPPORT FOR GARBAGE COLLECTION
  */
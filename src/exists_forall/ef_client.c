@@ -133,7 +133,8 @@ void ef_solve(ef_client_t *efc, ivector_t *assertions, param_t *parameters,
        * If the problem has integer or real variables, we force GEN_BY_PROJ
        */
       ef_solver_check(efc->efsolver, parameters, efc->ef_parameters.gen_mode,
-		      efc->ef_parameters.max_samples, efc->ef_parameters.max_iters);
+		      efc->ef_parameters.max_samples, efc->ef_parameters.max_iters,
+		      efc->ef_parameters.max_lemmas, efc->ef_parameters.persistent_forall);
       efc->efdone = true;
     }
   }
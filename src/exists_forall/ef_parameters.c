@@ -28,5 +28,7 @@ void init_ef_params(ef_param_t *p) {
   p->gen_mode = EF_GEN_AUTO_OPTION;
   p->max_samples = 5;
   p->max_iters = 100;
+  p->max_lemmas = 1;
+  p->persistent_forall = false;
 }
 
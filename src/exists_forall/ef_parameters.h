@@ -35,6 +35,9 @@
  * - gen_mode = generalization method
  * - max_samples = number of samples (max) used in start (0 means no presampling)
  * - max_iters = bound on the outher iteration in efsolver
+ * - max_lemmas = bound on the number of lemmas learned per iteration
+ * - persistent_forall = test candidates in one push/pop context per
+ *   universal constraint instead of substituting them (cf. efsolver.h)
  */
 typedef struct ef_param_s {
   bool flatten_iff;
@@ -42,6 +45,8 @@ typedef struct ef_param_s {
   ef_gen_option_t gen_mode;
   uint32_t max_samples;
   uint32_t max_iters;
+  uint32_t max_lemmas;
+  bool persistent_forall;
 } ef_param_t;
 
 
@@ -109,7 +109,7 @@ void print_full_map(FILE *f, ef_solver_t *solver) {
  * - logic/arch/parameters = for context initialization and check
  */
 void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, context_arch_t arch) {
-  uint32_t n;
+  uint32_t i, n;
 
   solver->prob = prob;
   solver->logic = logic;
@@ -121,12 +121,23 @@ void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, con
   solver->option = EF_GEN_BY_SUBST_OPTION;
   solver->max_samples = 0;
   solver->max_iters = 0;
+  solver->max_lemmas = 1;
+  solver->persistent_forall = false;
   solver->scan_idx = 0;
 
   solver->exists_context = NULL;
   solver->forall_context = NULL;
   solver->exists_model = NULL;
 
+  n = ef_prob_num_constraints(prob);
+  assert(n <= UINT32_MAX/sizeof(context_t *));
+  solver->cnstr_context = (context_t **) safe_malloc(n * sizeof(context_t *));
+  solver->cnstr_mode = (uint8_t *) safe_malloc(n * sizeof(uint8_t));
+  for (i=0; i<n; i++) {
+    solver->cnstr_context[i] = NULL;
+    solver->cnstr_mode[i] = EF_FORALL_UNSET;
+  }
+
   n = ef_prob_num_evars(prob);
   assert(n <= UINT32_MAX/sizeof(term_t));
   solver->evalue = (term_t *) safe_malloc(n * sizeof(term_t));
@@ -153,6 +164,20 @@ void init_ef_solver(ef_solver_t *solver, ef_prob_t *prob, smt_logic_t logic, con
  * Delete the whole thing
  */
 void delete_ef_solver(ef_solver_t *solver) {
+  uint32_t i, n;
+
+  n = ef_prob_num_constraints(solver->prob);
+  for (i=0; i<n; i++) {
+    if (solver->cnstr_context[i] != NULL) {
+      delete_context(solver->cnstr_context[i]);
+      safe_free(solver->cnstr_context[i]);
+    }
+  }
+  safe_free(solver->cnstr_context);
+  safe_free(solver->cnstr_mode);
+  solver->cnstr_context = NULL;
+  solver->cnstr_mode = NULL;
+
   if (solver->exists_context != NULL) {
     delete_context(solver->exists_context);
     safe_free(solver->exists_context);
@@ -318,12 +343,9 @@ static void init_forall_context(ef_solver_t *solver) {
  * Assert (B and not C) in ctx
  * - return the assertion code
  */
-static int32_t forall_context_assert(ef_solver_t *solver, term_t b, term_t c) {
-  context_t *ctx;
+static int32_t forall_context_assert(context_t *ctx, term_t b, term_t c) {
   term_t assertions[2];
 
-  ctx = solver->forall_context;
-
   assert(ctx != NULL && context_status(ctx) == STATUS_IDLE);
   assert(is_boolean_term(ctx->terms, b) && is_boolean_term(ctx->terms, c));
 
@@ -363,6 +385,56 @@ static context_t *get_forall_context(ef_solver_t *solver) {
 
 
 
+/*
+ * PERSISTENT FORALL CONTEXTS
+ */
+
+/*
+ * Build the context for constraint i and set its mode:
+ * - the context supports push/pop and stores B_i(Y_i) and not C_i(X_i, Y_i)
+ * - if that's trivially unsat, constraint i holds for all candidates
+ * - if the assertion fails, we'll use substitution for constraint i
+ */
+static void init_cnstr_context(ef_solver_t *solver, uint32_t i) {
+  context_t *ctx;
+  ef_cnstr_t *cnstr;
+  int32_t code;
+
+  assert(solver->cnstr_mode[i] == EF_FORALL_UNSET && solver->cnstr_context[i] == NULL);
+
+  cnstr = solver->prob->cnstr + i;
+  ctx = (context_t *) safe_malloc(sizeof(context_t));
+  init_context(ctx, solver->prob->terms, solver->logic, CTX_MODE_PUSHPOP, solver->arch, false);
+  if (solver->trace != NULL) {
+    context_set_trace(ctx, solver->trace);
+  }
+
+  code = forall_context_assert(ctx, cnstr->assumption, cnstr->guarantee);
+  if (code == CTX_NO_ERROR) {
+    solver->cnstr_context[i] = ctx;
+    solver->cnstr_mode[i] = EF_FORALL_PERSISTENT;
+    return;
+  }
+
+  solver->cnstr_mode[i] = (code == TRIVIALLY_UNSAT) ? EF_FORALL_VALID : EF_FORALL_SUBST;
+  delete_context(ctx);
+  safe_free(ctx);
+}
+
+
+/*
+ * Delete the context for constraint i and set its mode to mode
+ */
+static void drop_cnstr_context(ef_solver_t *solver, uint32_t i, ef_forall_mode_t mode) {
+  assert(solver->cnstr_context[i] != NULL);
+  delete_context(solver->cnstr_context[i]);
+  safe_free(solver->cnstr_context[i]);
+  solver->cnstr_context[i] = NULL;
+  solver->cnstr_mode[i] = mode;
+}
+
+
+
 
 
 /*
@@ -444,21 +516,13 @@ static smt_status_t ef_solver_check_exists(ef_solver_t *solver) {
 
 
 /*
- * Test the current exists model using universal constraint i
- * - i must be a valid index (i.e., 0 <= i < solver->prob->num_cnstr)
- * - this checks the assertion B_i and not C_i after replacing existential
- *   variables by their values (stored in evalue)
- * - return code:
- *   if STATUS_SAT (or STATUS_UNKNOWN): a model of (B_i and not C_i)
- *   is found and stored in uvalue_aux
- *   if STATUS_UNSAT: no model found (current exists model is good as
- *   far as constraint i is concerned)
- *   anything else: an error or interruption
- *
- * - if we get an error or interruption, solver->status is updated
- *   otherwise, it is kept as is (should be EF_STATUS_SEARCHING)
+ * Test the current exists model against constraint i by substitution
+ * - this replaces the existential variables by their values (stored
+ *   in evalue) in C_i, then checks B_i and not C_i in a fresh context
+ * - return code and solver->status are as in ef_solver_test_exists_model
+ *   below
  */
-static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, uint32_t i) {
+static smt_status_t ef_solver_test_by_subst(ef_solver_t *solver, uint32_t i) {
   context_t *forall_ctx;
   ef_cnstr_t *cnstr;
   term_t *value;
@@ -489,7 +553,7 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, uint32_t i)
 
   forall_ctx = get_forall_context(solver);
 
-  code = forall_context_assert(solver, cnstr->assumption, g); // assert B_i(Y_i) and not g(Y_i)
+  code = forall_context_assert(forall_ctx, cnstr->assumption, g); // assert B_i(Y_i) and not g(Y_i)
   if (code == CTX_NO_ERROR) {
     status = satisfy_context(forall_ctx, solver->parameters, cnstr->uvars, n, value, NULL);
     switch (status) {
@@ -526,6 +590,7 @@ static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, uint32_t i)
 
 
 
+
 /*
  * PROJECTION
  */
@@ -592,6 +657,144 @@ static void ef_project_exists_model(ef_prob_t *prob, term_t *value, term_t *evar
 
 
 
+/*
+ * TESTS OF CANDIDATES
+ */
+
+/*
+ * Test of the current exists model using the persistent context of constraint i
+ * - we assert X_i = x_i in a new scope, check, then pop
+ * - return false if X_i = x_i can't be asserted (the caller must then
+ *   use ef_solver_test_by_subst); return true and store the check
+ *   status in *status otherwise
+ * - after an interruption or error, the context is deleted since it may
+ *   not be in a clean state
+ */
+static bool ef_solver_test_in_cnstr_context(ef_solver_t *solver, uint32_t i, smt_status_t *status) {
+  context_t *ctx;
+  ef_cnstr_t *cnstr;
+  term_t *eq, *value;
+  uint32_t j, n, m;
+  int32_t code;
+  smt_status_t stat;
+
+  assert(i < ef_prob_num_constraints(solver->prob));
+  assert(solver->cnstr_mode[i] == EF_FORALL_PERSISTENT);
+
+  cnstr = solver->prob->cnstr + i;
+  ctx = solver->cnstr_context[i];
+
+  /*
+   * equalities X_i = x_i in evalue_aux
+   */
+  n = ef_constraint_num_evars(cnstr);
+  resize_ivector(&solver->evalue_aux, n);
+  solver->evalue_aux.size = n;
+  eq = solver->evalue_aux.data;
+  ef_project_exists_model(solver->prob, solver->evalue, cnstr->evars, eq, n);
+  for (j=0; j<n; j++) {
+    eq[j] = mk_eq(solver->prob->manager, cnstr->evars[j], eq[j]);
+  }
+
+  /*
+   * make uvalue_aux large enough
+   */
+  m = ef_constraint_num_uvars(cnstr);
+  resize_ivector(&solver->uvalue_aux, m);
+  solver->uvalue_aux.size = m;
+  value = solver->uvalue_aux.data;
+
+  context_push(ctx);
+  code = assert_formulas(ctx, n, eq);
+  if (code == CTX_NO_ERROR) {
+    stat = satisfy_context(ctx, solver->parameters, cnstr->uvars, m, value, NULL);
+  } else if (code == TRIVIALLY_UNSAT) {
+    assert(context_status(ctx) == STATUS_UNSAT);
+    stat = STATUS_UNSAT;
+  } else {
+    drop_cnstr_context(solver, i, EF_FORALL_SUBST);
+    return false;
+  }
+
+  switch (stat) {
+  case STATUS_SAT:
+  case STATUS_UNKNOWN:
+    context_clear(ctx);
+    context_pop(ctx);
+    break;
+
+  case STATUS_UNSAT:
+    context_clear_unsat(ctx);
+    context_pop(ctx);
+    break;
+
+  case STATUS_INTERRUPTED:
+    solver->status = EF_STATUS_INTERRUPTED;
+    drop_cnstr_context(solver, i, EF_FORALL_UNSET);
+    break;
+
+  default:
+    solver->status = EF_STATUS_CHECK_ERROR;
+    solver->error_code = stat;
+    drop_cnstr_context(solver, i, EF_FORALL_UNSET);
+    break;
+  }
+
+  *status = stat;
+  return true;
+}
+
+
+/*
+ * Test the current exists model using universal constraint i
+ * - i must be a valid index (i.e., 0 <= i < solver->prob->num_cnstr)
+ * - this checks the assertion B_i and not C_i after replacing existential
+ *   variables by their values (stored in evalue)
+ * - return code:
+ *   if STATUS_SAT (or STATUS_UNKNOWN): a model of (B_i and not C_i)
+ *   is found and stored in uvalue_aux
+ *   if STATUS_UNSAT: no model found (current exists model is good as
+ *   far as constraint i is concerned)
+ *   anything else: an error or interruption
+ *
+ * - if we get an error or interruption, solver->status is updated
+ *   otherwise, it is kept as is (should be EF_STATUS_SEARCHING)
+ */
+static smt_status_t ef_solver_test_exists_model(ef_solver_t *solver, uint32_t i) {
+  smt_status_t status;
+
+  assert(i < ef_prob_num_constraints(solver->prob));
+
+  if (! solver->persistent_forall) {
+    return ef_solver_test_by_subst(solver, i);
+  }
+
+  if (solver->cnstr_mode[i] == EF_FORALL_UNSET) {
+    init_cnstr_context(solver, i);
+  }
+
+  switch (solver->cnstr_mode[i]) {
+  case EF_FORALL_PERSISTENT:
+    if (ef_solver_test_in_cnstr_context(solver, i, &status)) {
+      break;
+    }
+    // fall back to substitution
+    assert(solver->cnstr_mode[i] == EF_FORALL_SUBST);
+  case EF_FORALL_SUBST:
+    status = ef_solver_test_by_subst(solver, i);
+    break;
+
+  case EF_FORALL_VALID:
+  default:
+    status = STATUS_UNSAT;
+    break;
+  }
+
+  return status;
+}
+
+
+
 
 /*
  * PRE SAMPLING
@@ -1042,11 +1245,15 @@ static void trace_candidate_check(ef_solver_t *solver, uint32_t i, smt_status_t
 }
 
 /*
- * Check whether the current exists_model can be falsified by one
- * of the universal constraints.
- * - scan the universal constraints starting from solver->scan_idx
+ * Check whether the current exists_model can be falsified by
+ * the universal constraints.
+ * - scan all the universal constraints starting from solver->scan_idx
  * - the current exists model is defined by
  *   the mapping from solver->prob->evars to solver->evalues
+ * - we stop after solver->max_lemmas constraints have falsified the
+ *   model (and have been learned). By default max_lemmas is 1: a round
+ *   stops at the first counterexample. With a larger bound, a single
+ *   round can refine the exists context with several lemmas.
  *
  * Update the solver->status as follows:
  * - if no constraint falsifies the model, solver->status = EF_STATUS_SAT
@@ -1054,12 +1261,12 @@ static void trace_candidate_check(ef_solver_t *solver, uint32_t i, smt_status_t
  *   updated to EF_STATUS_UNSAT (trivially unsat after learning)
  * - if something goes wrong, solver->status = EF_STATUS_ERROR
  *
- * If constraint i falsifies the model then solver->scan_idx is
- * set to (i+1) modulo num_constraints.
+ * If constraint i is the last one to falsify the model then
+ * solver->scan_idx is set to (i+1) modulo num_constraints.
  */
 static void  ef_solver_check_exists_model(ef_solver_t *solver) {
   smt_status_t status;
-  uint32_t i, n;
+  uint32_t i, n, next, learned;
 
   n = ef_prob_num_constraints(solver->prob);
 
@@ -1072,6 +1279,10 @@ static void  ef_solver_check_exists_model(ef_solver_t *solver) {
     return;
   }
 
+  assert(solver->max_lemmas > 0);
+
+  learned = 0;
+  next = solver->scan_idx;
   i = solver->scan_idx;
   do {
     trace_printf(solver->trace, 4, "(EF: testing candidate against constraint %"PRIu32")\n", i);
@@ -1088,21 +1299,33 @@ static void  ef_solver_check_exists_model(ef_solver_t *solver) {
       fflush(stdout);
 #endif
       ef_solver_learn(solver, i);
+      learned ++;
+      next = i + 1;
+      if (next == n) {
+        next = 0;
+      }
+      break;
 
     default:
-      i ++;
-      if (i == n) {
-	i = 0;
-      }
+      // UNSAT: constraint i holds
+      // otherwise: solver->status has been updated
       break;
     }
 
-  } while (status == STATUS_UNSAT && i != solver->scan_idx);
+    i ++;
+    if (i == n) {
+      i = 0;
+    }
 
-  solver->scan_idx = i; // prepare for the next call
-  if (status == STATUS_UNSAT) {
-    // done a full scan
-    solver->status = EF_STATUS_SAT;
+  } while (solver->status == EF_STATUS_SEARCHING && learned < solver->max_lemmas &&
+	   i != solver->scan_idx);
+
+  if (solver->status == EF_STATUS_SEARCHING) {
+    solver->scan_idx = next; // prepare for the next call
+    if (learned == 0) {
+      // done a full scan
+      solver->status = EF_STATUS_SAT;
+    }
   }
 }
 
@@ -1216,11 +1439,14 @@ static void ef_solver_search(ef_solver_t *solver) {
  *   (as in ef_solver_search).
  */
 void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
-		     ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters) {
+		     ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters,
+		     uint32_t max_lemmas, bool persistent_forall) {
   solver->parameters = parameters;
   solver->option = gen_mode;
   solver->max_samples = max_samples;
   solver->max_iters = max_iters;
+  solver->max_lemmas = max_lemmas;
+  solver->persistent_forall = persistent_forall;
   solver->scan_idx = 0;
 
   // adjust mode
@@ -140,10 +140,17 @@
  * + generalization option
  * + presampling setting: if max_samples is 0, no presampling
  *   otherwise, max_samples is used for sampling
+ * + max_lemmas: bound on the number of universal constraints that
+ *   are learned in one round (i.e., for the same candidate)
+ * + persistent_forall: if true, candidates are tested in one push/pop
+ *   context per universal constraint (cf. ef_forall_mode_t); otherwise
+ *   they are substituted then checked in a fresh context
  *
  * Internal data structures:
  * - exists_context, forall_context: pointers to contexts, allocated and initialized
  *   when needed
+ * - cnstr_context[i] = persistent forall context for universal constraint i
+ *   (allocated on the first test of constraint i, cf. ef_forall_mode_t)
  * - evalue = array large enough to store the value of all exists variables
  * - uvalue = array large enough to store the value of all universal variables
  * - evalue_aux and uvalue_aux = auxiliary vectors (to store value vector of smaller
@@ -162,6 +169,29 @@ typedef enum ef_gen_option {
 } ef_gen_option_t;
 
 
+/*
+ * Mode of the forall context for a universal constraint
+ *
+ *   (FORALL Y_i: B_i(Y_i) => C_i(X_i, Y_i))
+ *
+ * - if persistent_forall is set and when possible, we keep one context
+ *   per constraint, where
+ *   B_i(Y_i) and not C_i(X_i, Y_i) are asserted once. Every candidate x_i
+ *   is then tested by asserting X_i = x_i between push and pop, so
+ *   the context keeps its learned clauses from one iteration to the next.
+ * - this is not possible if C_i(X_i, Y_i) can't be internalized (e.g.,
+ *   if it's nonlinear but C_i(x_i, Y_i) is linear) or if X_i = x_i can't be
+ *   asserted. Then we fall back to substituting x_i in C_i and checking
+ *   in a fresh context.
+ */
+typedef enum ef_forall_mode {
+  EF_FORALL_UNSET,       // context not built yet
+  EF_FORALL_PERSISTENT,  // context stores B_i(Y_i) and not C_i(X_i, Y_i)
+  EF_FORALL_VALID,       // B_i(Y_i) and not C_i(X_i, Y_i) is trivially unsat
+  EF_FORALL_SUBST,       // fallback: substitute then check in a fresh context
+} ef_forall_mode_t;
+
+
 /*
  * Status + error report
  */
@@ -209,6 +239,8 @@ typedef struct ef_solver_s {
   ef_gen_option_t option;    // generalization mode
   uint32_t max_samples;      // bound on pre-sampling: 0 means no pre-sampling
   uint32_t max_iters;        // bound on outer iterations
+  uint32_t max_lemmas;       // bound on lemmas learned per iteration
+  bool persistent_forall;    // test candidates in per-constraint contexts
   uint32_t iters;            // number of outer iterations
   uint32_t scan_idx;         // first universal constraint to check
 
@@ -216,6 +248,8 @@ typedef struct ef_solver_s {
   context_t *exists_context;
   context_t *forall_context;
   model_t *exists_model;
+  context_t **cnstr_context;
+  uint8_t *cnstr_mode;       // ef_forall_mode_t for each constraint
   term_t *evalue;
   term_t *uvalue;
 
@@ -275,7 +309,8 @@ extern void ef_solver_set_trace(ef_solver_t *solver, tracer_t *trace);
  * Also solver->iters stores the number of iterations required.
  */
 extern void ef_solver_check(ef_solver_t *solver, const param_t *parameters,
-			    ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters);
+			    ef_gen_option_t gen_mode, uint32_t max_samples, uint32_t max_iters,
+			    uint32_t max_lemmas, bool persistent_forall);
 
 
 /*
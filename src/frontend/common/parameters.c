@@ -37,14 +37,19 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "aux-eq-ratio",
   "bland-threshold",
   "branching",
+  "bv-lazy-width",
   "bvarith-elim",
   "c-factor",
   "c-threshold",
+  "cache-explanations",
   "cache-tclauses",
   "clause-decay",
   "d-factor",
   "d-threshold",
   "dyn-ack",
+  "dyn-ack-budget",
+  "dyn-ack-budget-period",
+  "dyn-ack-decay-period",
   "dyn-ack-threshold",
   "dyn-bool-ack",
   "dyn-bool-ack-threshold",
@@ -53,7 +58,9 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "ef-flatten-ite",
   "ef-gen-mode",
   "ef-max-iters",
+  "ef-max-lemmas",
   "ef-max-samples",
+  "ef-persistent-forall",
   "fast-restarts",
   "flatten",
   "icheck",
@@ -70,6 +77,7 @@ static const char * const param_names[NUM_PARAMETERS] = {
   "mcsat-nra-bound-min",
   "mcsat-nra-mgcd",
   "mcsat-nra-nlsat",
+  "mcsat-var-order-vmtf",
   "optimistic-fcheck",
   "prop-threshold",
   "r-factor",
@@ -91,14 +99,19 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_AUX_EQ_RATIO,
   PARAM_BLAND_THRESHOLD,
   PARAM_BRANCHING,
+  PARAM_BV_LAZY_WIDTH,
   PARAM_BVARITH_ELIM,
   PARAM_C_FACTOR,
   PARAM_C_THRESHOLD,
+  PARAM_CACHE_EXPLANATIONS,
   PARAM_CACHE_TCLAUSES,
   PARAM_CLAUSE_DECAY,
   PARAM_D_FACTOR,
   PARAM_D_THRESHOLD,
   PARAM_DYN_ACK,
+  PARAM_DYN_ACK_BUDGET,
+  PARAM_DYN_ACK_BUDGET_PERIOD,
+  PARAM_DYN_ACK_DECAY_PERIOD,
   PARAM_DYN_ACK_THRESHOLD,
   PARAM_DYN_BOOL_ACK,
   PARAM_DYN_BOOL_ACK_THRESHOLD,
@@ -107,7 +120,9 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_EF_FLATTEN_ITE,
   PARAM_EF_GEN_MODE,
   PARAM_EF_MAX_ITERS,
+  PARAM_EF_MAX_LEMMAS,
   PARAM_EF_MAX_SAMPLES,
+  PARAM_EF_PERSISTENT_FORALL,
   PARAM_FAST_RESTARTS,
   PARAM_FLATTEN,
   PARAM_ICHECK,
@@ -124,6 +139,7 @@ static const yices_param_t param_code[NUM_PARAMETERS] = {
   PARAM_MCSAT_NRA_BOUND_MIN,
   PARAM_MCSAT_NRA_MGCD,
   PARAM_MCSAT_NRA_NLSAT,
+  PARAM_MCSAT_VAR_ORDER_VMTF,
   PARAM_OPTIMISTIC_FCHECK,
   PARAM_PROP_THRESHOLD,
   PARAM_R_FACTOR,
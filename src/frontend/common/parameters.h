@@ -70,12 +70,16 @@ typedef enum yices_param {
   PARAM_DYN_ACK,
   PARAM_DYN_BOOL_ACK,
   PARAM_OPTIMISTIC_FCHECK,
+  PARAM_CACHE_EXPLANATIONS,
   PARAM_MAX_ACK,
   PARAM_MAX_BOOL_ACK,
   PARAM_AUX_EQ_QUOTA,
   PARAM_AUX_EQ_RATIO,
   PARAM_DYN_ACK_THRESHOLD,
   PARAM_DYN_BOOL_ACK_THRESHOLD,
+  PARAM_DYN_ACK_BUDGET,
+  PARAM_DYN_ACK_BUDGET_PERIOD,
+  PARAM_DYN_ACK_DECAY_PERIOD,
   PARAM_MAX_INTERFACE_EQS,
   // simplex parameters
   PARAM_EAGER_LEMMAS,
@@ -88,18 +92,23 @@ typedef enum yices_param {
   // array solver parameters
   PARAM_MAX_UPDATE_CONFLICTS,
   PARAM_MAX_EXTENSIONALITY,
+  // bitvector solver
+  PARAM_BV_LAZY_WIDTH,
   // EF solver
   PARAM_EF_FLATTEN_IFF,
   PARAM_EF_FLATTEN_ITE,
   PARAM_EF_GEN_MODE,
   PARAM_EF_MAX_SAMPLES,
   PARAM_EF_MAX_ITERS,
+  PARAM_EF_MAX_LEMMAS,
+  PARAM_EF_PERSISTENT_FORALL,
   // mcsat options
   PARAM_MCSAT_NRA_MGCD,
   PARAM_MCSAT_NRA_NLSAT,
   PARAM_MCSAT_NRA_BOUND,
   PARAM_MCSAT_NRA_BOUND_MIN,
   PARAM_MCSAT_NRA_BOUND_MAX,
+  PARAM_MCSAT_VAR_ORDER_VMTF,
   // error
   PARAM_UNKNOWN
 } yices_param_t;
@@ -601,6 +601,15 @@ static smt_status_t check_with_assumptions(context_t *ctx, const param_t *params
     return STATUS_UNSAT;
   }
 
+  // the MC-SAT solver takes the assumptions as terms
+  if (ctx->mcsat != NULL) {
+    status = check_context_with_term_assumptions(ctx, params, n, a);
+    if (status == STATUS_UNSAT) {
+      context_build_unsat_core(ctx, core);
+    }
+    return status;
+  }
+
   // convert a[0] ... a[n-1] to assumptions
   init_ivector(&assumptions, n);
   for (i=0; i<n; i++) {
@@ -1618,6 +1627,8 @@ static void show_bvsolver_stats(int fd, print_buffer_t *b, bv_solver_t *solver)
   print_string_and_uint32(fd, b, " :bvsolver-atoms ", bv_solver_num_atoms(solver));
   print_string_and_uint32(fd, b, " :bvsolver-equiv-lemmas ", bv_solver_equiv_lemmas(solver));
   print_string_and_uint32(fd, b, " :bvsolver-interface-lemmas ", bv_solver_interface_lemmas(solver));
+  print_string_and_uint32(fd, b, " :bvsolver-lazy-vars ", bv_solver_lazy_vars(solver));
+  print_string_and_uint32(fd, b, " :bvsolver-lazy-refinements ", bv_solver_lazy_refinements(solver));
 }
 
 static void show_idl_fw_stats(int fd, print_buffer_t *b, idl_solver_t *solver) {
@@ -3254,8 +3265,7 @@ static void ctx_unsat_core(smt2_globals_t *g) {
 
 
 /*
- * Check with assumptions:
- * - not supported by the mcsat solver
+ * Check with assumptions
  */
 static void ctx_check_sat_assuming(smt2_globals_t *g, uint32_t n, signed_symbol_t *a) {
   assumptions_and_core_t *assumptions;
@@ -4664,6 +4674,10 @@ static bool yices_get_option(const smt2_globals_t *g, yices_param_t p) {
     print_boolean_value(g->parameters.use_optimistic_fcheck);
     break;
 
+  case PARAM_CACHE_EXPLANATIONS:
+    print_boolean_value(g->parameters.use_expl_cache);
+    break;
+
   case PARAM_MAX_ACK:
     print_uint32_value(g->parameters.max_ackermann);
     break;
@@ -4688,6 +4702,18 @@ static bool yices_get_option(const smt2_globals_t *g, yices_param_t p) {
     print_uint32_value((uint32_t) g->parameters.dyn_bool_ack_threshold);
     break;
 
+  case PARAM_DYN_ACK_BUDGET:
+    print_uint32_value(g->parameters.dyn_ack_budget);
+    break;
+
+  case PARAM_DYN_ACK_BUDGET_PERIOD:
+    print_uint32_value(g->parameters.dyn_ack_budget_period);
+    break;
+
+  case PARAM_DYN_ACK_DECAY_PERIOD:
+    print_uint32_value(g->parameters.dyn_ack_decay_period);
+    break;
+
   case PARAM_MAX_INTERFACE_EQS:
     print_uint32_value(g->parameters.max_interface_eqs);
     break;
@@ -4728,6 +4754,10 @@ static bool yices_get_option(const smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->parameters.max_extensionality);
     break;
 
+  case PARAM_BV_LAZY_WIDTH:
+    print_uint32_value(g->parameters.bv_lazy_width);
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     print_boolean_value(g->ef_client.ef_parameters.flatten_iff);
     break;
@@ -4748,6 +4778,14 @@ static bool yices_get_option(const smt2_globals_t *g, yices_param_t p) {
     print_uint32_value(g->ef_client.ef_parameters.max_iters);
     break;
 
+  case PARAM_EF_MAX_LEMMAS:
+    print_uint32_value(g->ef_client.ef_parameters.max_lemmas);
+    break;
+
+  case PARAM_EF_PERSISTENT_FORALL:
+    print_boolean_value(g->ef_client.ef_parameters.persistent_forall);
+    break;
+
   case PARAM_UNKNOWN:
   default:
     freport_bug(g->err,"invalid parameter id in 'yices_get_option'");
@@ -5194,6 +5232,12 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_CACHE_EXPLANATIONS:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->parameters.use_expl_cache = tt;
+    }
+    break;
+
   case PARAM_MAX_ACK:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       g->parameters.max_ackermann = n;
@@ -5230,6 +5274,24 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_DYN_ACK_BUDGET:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->parameters.dyn_ack_budget = n;
+    }
+    break;
+
+  case PARAM_DYN_ACK_BUDGET_PERIOD:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->parameters.dyn_ack_budget_period = n;
+    }
+    break;
+
+  case PARAM_DYN_ACK_DECAY_PERIOD:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      g->parameters.dyn_ack_decay_period = n;
+    }
+    break;
+
   case PARAM_MAX_INTERFACE_EQS:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       g->parameters.max_interface_eqs = n;
@@ -5306,6 +5368,16 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_BV_LAZY_WIDTH:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      if (n <= 64) {
+        g->parameters.bv_lazy_width = n;
+      } else {
+        reason = "must be between 0 and 64";
+      }
+    }
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->ef_client.ef_parameters.flatten_iff = tt;
@@ -5336,6 +5408,18 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_EF_MAX_LEMMAS:
+    if (param_val_to_pos32(param, val, &n, &reason)) {
+      g->ef_client.ef_parameters.max_lemmas = n;
+    }
+    break;
+
+  case PARAM_EF_PERSISTENT_FORALL:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->ef_client.ef_parameters.persistent_forall = tt;
+    }
+    break;
+
   case PARAM_MCSAT_NRA_MGCD:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       g->mcsat_options.nra_mgcd = tt;
@@ -5366,6 +5450,12 @@ static void yices_set_option(smt2_globals_t *g, const char *param, const param_v
     }
     break;
 
+  case PARAM_MCSAT_VAR_ORDER_VMTF:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      g->mcsat_options.var_order_vmtf = tt;
+    }
+    break;
+
   case PARAM_UNKNOWN:
   default:
     unsupported = true;
@@ -5609,18 +5699,6 @@ void smt2_set_logic(const char *name) {
     }
   }
 
-  // if unsat cores or unsat assumptions are requested, we can't use the mcsat solver
-  if (__smt2_globals.produce_unsat_cores || __smt2_globals.produce_unsat_assumptions) {
-    if (__smt2_globals.mcsat) {
-      print_error("the mcsat solver does not support unsat cores");
-      return;
-    }
-    if (arch == CTX_ARCH_MCSAT) {
-      print_error("unsat cores are not supported in logic %s", name);
-      return;
-    }
-  }
-
   smt2_lexer_activate_logic(code);
   __smt2_globals.logic_code = code;
   __smt2_globals.logic_name = clone_string(name);
@@ -5933,15 +6011,6 @@ void smt2_check_sat(void) {
 }
 
 
-/*
- * Check whether the logic requires mcsat or the mcsat flag is set.
- * In either case, check_sat_assuming is not supported.
- */
-static bool mcsat_is_required(smt2_globals_t *g) {
-  assert(g->logic_code != SMT_UNKNOWN);
-  return g->mcsat || arch_for_logic(g->logic_code) == CTX_ARCH_MCSAT;
-}
-
 /*
  * Check sat with assumptions:
  * - n = number of assumptions
@@ -5955,9 +6024,7 @@ void smt2_check_sat_assuming(uint32_t n, signed_symbol_t *a) {
   tprint_calls("check-sat-assuming", __smt2_globals.stats.num_check_sat_assuming);
 
   if (check_logic()) {
-    if (mcsat_is_required(&__smt2_globals)) {
-      print_error("check-sat-assuming is not supported in logic %s", __smt2_globals.logic_name);
-    } else if (__smt2_globals.benchmark_mode) {
+    if (__smt2_globals.benchmark_mode) {
       if (__smt2_globals.efmode) {
         print_error("the exists/forall solver does not support check-sat with assumptions");
       } else if (__smt2_globals.frozen) {
@@ -1275,6 +1275,10 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_bool_param(param2string[p], parameters.use_optimistic_fcheck, n);
     break;
 
+  case PARAM_CACHE_EXPLANATIONS:
+    show_bool_param(param2string[p], parameters.use_expl_cache, n);
+    break;
+
   case PARAM_MAX_ACK:
     show_pos32_param(param2string[p], parameters.max_ackermann, n);
     break;
@@ -1299,6 +1303,18 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], (uint32_t) parameters.dyn_bool_ack_threshold, n);
     break;
 
+  case PARAM_DYN_ACK_BUDGET:
+    show_pos32_param(param2string[p], parameters.dyn_ack_budget, n);
+    break;
+
+  case PARAM_DYN_ACK_BUDGET_PERIOD:
+    show_pos32_param(param2string[p], parameters.dyn_ack_budget_period, n);
+    break;
+
+  case PARAM_DYN_ACK_DECAY_PERIOD:
+    show_pos32_param(param2string[p], parameters.dyn_ack_decay_period, n);
+    break;
+
   case PARAM_MAX_INTERFACE_EQS:
     show_pos32_param(param2string[p], parameters.max_interface_eqs, n);
     break;
@@ -1339,6 +1355,10 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], parameters.max_extensionality, n);
     break;
 
+  case PARAM_BV_LAZY_WIDTH:
+    show_pos32_param(param2string[p], parameters.bv_lazy_width, n);
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     show_bool_param(param2string[p], ef_client_globals.ef_parameters.flatten_iff, n);
     break;
@@ -1359,6 +1379,14 @@ static void show_param(yices_param_t p, uint32_t n) {
     show_pos32_param(param2string[p], ef_client_globals.ef_parameters.max_iters, n);
     break;
 
+  case PARAM_EF_MAX_LEMMAS:
+    show_pos32_param(param2string[p], ef_client_globals.ef_parameters.max_lemmas, n);
+    break;
+
+  case PARAM_EF_PERSISTENT_FORALL:
+    show_bool_param(param2string[p], ef_client_globals.ef_parameters.persistent_forall, n);
+    break;
+
   case PARAM_UNKNOWN:
   default:
     freport_bug(stderr,"invalid parameter id in 'show_param'");
@@ -1636,6 +1664,13 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_CACHE_EXPLANATIONS:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      parameters.use_expl_cache = tt;
+      print_ok();
+    }
+    break;
+
   case PARAM_MAX_ACK:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       parameters.max_ackermann = n;
@@ -1678,6 +1713,27 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_DYN_ACK_BUDGET:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      parameters.dyn_ack_budget = n;
+      print_ok();
+    }
+    break;
+
+  case PARAM_DYN_ACK_BUDGET_PERIOD:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      parameters.dyn_ack_budget_period = n;
+      print_ok();
+    }
+    break;
+
+  case PARAM_DYN_ACK_DECAY_PERIOD:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      parameters.dyn_ack_decay_period = n;
+      print_ok();
+    }
+    break;
+
   case PARAM_MAX_INTERFACE_EQS:
     if (param_val_to_pos32(param, val, &n, &reason)) {
       parameters.max_interface_eqs = n;
@@ -1762,6 +1818,17 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_BV_LAZY_WIDTH:
+    if (param_val_to_nonneg32(param, val, &n, &reason)) {
+      if (n <= 64) {
+        parameters.bv_lazy_width = n;
+        print_ok();
+      } else {
+        reason = "must be between 0 and 64";
+      }
+    }
+    break;
+
   case PARAM_EF_FLATTEN_IFF:
     if (param_val_to_bool(param, val, &tt, &reason)) {
       ef_client_globals.ef_parameters.flatten_iff = tt;
@@ -1797,6 +1864,20 @@ static void yices_setparam_cmd(const char *param, const param_val_t *val) {
     }
     break;
 
+  case PARAM_EF_MAX_LEMMAS:
+    if (param_val_to_pos32(param, val, &n, &reason)) {
+      ef_client_globals.ef_parameters.max_lemmas = n;
+      print_ok();
+    }
+    break;
+
+  case PARAM_EF_PERSISTENT_FORALL:
+    if (param_val_to_bool(param, val, &tt, &reason)) {
+      ef_client_globals.ef_parameters.persistent_forall = tt;
+      print_ok();
+    }
+    break;
+
   case PARAM_UNKNOWN:
   default:
     report_invalid_param(param);
@@ -1876,6 +1957,8 @@ static void show_egraph_stats(egraph_stats_t *stat) {
   printf(" other dyn ack.lemmas    : %"PRIu32"\n", stat->ack_lemmas);
   printf(" final checks            : %"PRIu32"\n", stat->final_checks);
   printf(" interface equalities    : %"PRIu32"\n", stat->interface_eqs);
+  printf(" cached th. explanations : %"PRIu32"\n", stat->th_expl_hits);
+  printf(" built th. explanations  : %"PRIu32"\n", stat->th_expl_misses);
 }
 
 static void show_funsolver_stats(fun_solver_stats_t *stat) {
@@ -1943,6 +2026,8 @@ static void show_bvsolver_stats(bv_solver_t *solver) {
   printf(" sge atoms               : %"PRIu32"\n", bv_solver_num_sge_atoms(solver));
   printf(" equiv lemmas            : %"PRIu32"\n", solver->stats.equiv_lemmas);
   printf(" interface lemmas        : %"PRIu32"\n", solver->stats.interface_lemmas);
+  printf(" lazy mul/div vars       : %"PRIu32"\n", solver->stats.lazy_vars);
+  printf(" lazy refinements        : %"PRIu32"\n", solver->stats.lazy_refinements);
 }
 
 
@@ -1110,6 +1110,8 @@ static void show_egraph_stats(egraph_stats_t *stat) {
   printf(" other dyn ack.lemmas    : %"PRIu32"\n", stat->ack_lemmas);
   printf(" final checks            : %"PRIu32"\n", stat->final_checks);
   printf(" interface equalities    : %"PRIu32"\n", stat->interface_eqs);
+  printf(" cached th. explanations : %"PRIu32"\n", stat->th_expl_hits);
+  printf(" built th. explanations  : %"PRIu32"\n", stat->th_expl_misses);
 }
 
 /*
@@ -1190,6 +1192,8 @@ static void show_bvsolver_stats(bv_solver_t *solver) {
   printf(" equiv conflicts         : %"PRIu32"\n", solver->stats.equiv_conflicts);
   printf(" semi-equiv lemmas       : %"PRIu32"\n", solver->stats.half_equiv_lemmas);
   printf(" interface lemmas        : %"PRIu32"\n", solver->stats.interface_lemmas);
+  printf(" lazy mul/div vars       : %"PRIu32"\n", solver->stats.lazy_vars);
+  printf(" lazy refinements        : %"PRIu32"\n", solver->stats.lazy_refinements);
 }
 
 
@@ -80,6 +80,7 @@ static bool mcsat_nra_nlsat;
 static bool mcsat_nra_bound;
 static int32_t mcsat_nra_bound_min;
 static int32_t mcsat_nra_bound_max;
+static bool mcsat_var_order_vmtf;
 
 static pvector_t trace_tags;
 
@@ -103,6 +104,7 @@ typedef enum optid {
   mcsat_nra_bound_opt,     // search by increasing bound
   mcsat_nra_bound_min_opt, // set initial bound
   mcsat_nra_bound_max_opt, // set maximal bound
+  mcsat_var_order_vmtf_opt,// use move-to-front variable order instead of VSIDS
   trace_opt,               // enable a trace tag
 } optid_t;
 
@@ -126,6 +128,7 @@ static option_desc_t options[NUM_OPTIONS] = {
   { "mcsat-nra-bound", '\0', FLAG_OPTION, mcsat_nra_bound_opt },
   { "mcsat-nra-bound-min", '\0', MANDATORY_INT, mcsat_nra_bound_min_opt },
   { "mcsat-nra-bound-max", '\0', MANDATORY_INT, mcsat_nra_bound_max_opt },
+  { "mcsat-var-order-vmtf", '\0', FLAG_OPTION, mcsat_var_order_vmtf_opt },
   { "trace", 't', MANDATORY_STRING, trace_opt },
 };
 
@@ -166,7 +169,8 @@ static void print_help(const char *progname) {
    "    --mcsat-nra-nlsat         Use NLSAT projection instead of Brown's single-cell construction\n"
    "    --mcsat-nra-bound         Search by increasing the bound on variable magnitude\n"
    "    --mcsat-nra-bound-min=<B> Set initial lower bound\n"
-   "    --mcsat-nra-bound-max=<B> Set maximal bound for search"
+   "    --mcsat-nra-bound-max=<B> Set maximal bound for search\n"
+   "    --mcsat-var-order-vmtf    Use move-to-front variable ordering instead of VSIDS"
    ""
 #endif
 	 "\n"
@@ -207,6 +211,7 @@ static void parse_command_line(int argc, char *argv[]) {
   mcsat_nra_bound = false;
   mcsat_nra_bound_min = -1;
   mcsat_nra_bound_max = -1;
+  mcsat_var_order_vmtf = false;
 
   init_pvector(&trace_tags, 5);
 
@@ -361,6 +366,16 @@ static void parse_command_line(int argc, char *argv[]) {
 #endif
         break;
 
+      case mcsat_var_order_vmtf_opt:
+#if HAVE_MCSAT
+        mcsat_var_order_vmtf = true;
+#else
+        fprintf(stderr, "mcsat is not supported: %s was not compiled with mcsat support\n", parser.command_name);
+        code = YICES_EXIT_USAGE;
+        goto exit;
+#endif
+        break;
+
       case trace_opt:
         pvector_push(&trace_tags, elem.s_value);
         break;
@@ -430,6 +445,10 @@ static void setup_mcsat(void) {
     smt2_set_option(":yices-mcsat-nra-bound-max", aval_bound_max);
     q_clear(&q);
   }
+
+  if (mcsat_var_order_vmtf) {
+    smt2_set_option(":yices-mcsat-var-order-vmtf", aval_true);
+  }
 }
 
 
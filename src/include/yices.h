@@ -2604,6 +2604,29 @@ __YICES_DLLSPEC__ extern void yices_garbage_collect(const term_t t[], uint32_t n
                                                     int32_t keep_named);
 
 
+/*
+ * Minor garbage collection: collect only the terms created since
+ * the previous call to the garbage collector (either this function
+ * or yices_garbage_collect).
+ * - t = optional array of terms
+ * - nt = size of t
+ *
+ * Terms are immutable so older terms never refer to younger ones.
+ * This function keeps all the older terms without visiting them, and
+ * deletes the young terms that are not reachable from a root. The roots
+ * are the same as in yices_garbage_collect with keep_named true: all
+ * terms used by contexts and models, the elements of t[0 ... nt-1],
+ * the terms with a positive reference count, and the named terms.
+ * Types are not collected.
+ *
+ * The cost is proportional to the number of young terms and roots,
+ * not to the total number of terms. Before the first call to the
+ * garbage collector, all terms are young and this function does a
+ * full collection.
+ */
+__YICES_DLLSPEC__ extern void yices_garbage_collect_young(const term_t t[], uint32_t nt);
+
+
 
 
 /****************************
@@ -3073,6 +3096,50 @@ __YICES_DLLSPEC__ extern int32_t yices_assert_formula(context_t *ctx, term_t t);
 __YICES_DLLSPEC__ extern int32_t yices_assert_formulas(context_t *ctx, uint32_t n, const term_t t[]);
 
 
+/*
+ * Assert an array of n formulas t[0 ... n-1] in a fresh context ctx
+ * and keep the result of preprocessing (simplified assertions and
+ * variable substitutions) in ctx. Other contexts with the same
+ * configuration can then assert the same formulas without repeating
+ * the preprocessing, by calling yices_assert_snapshot.
+ *
+ * - ctx must be fresh: nothing asserted yet and status STATUS_IDLE
+ * - the snapshot is kept until ctx is reset or freed
+ *
+ * The function returns -1 on error, 0 otherwise.
+ *
+ * Error report:
+ * - as in yices_assert_formulas if a term is invalid or not Boolean,
+ *   or if a formula is outside the logic supported by ctx
+ * - if ctx uses MCSAT or one of the automatic difference-logic solvers
+ *   code = CTX_OPERATION_NOT_SUPPORTED
+ * - if ctx is not fresh
+ *   code = CTX_INVALID_OPERATION
+ */
+__YICES_DLLSPEC__ extern int32_t yices_assert_formulas_with_snapshot(context_t *ctx, uint32_t n, const term_t t[]);
+
+
+/*
+ * Assert in ctx the formulas saved in src by yices_assert_formulas_with_snapshot.
+ * The result is the same as calling yices_assert_formulas(ctx, n, t) with the
+ * same formulas, but flattening, variable elimination, and the other
+ * preprocessing steps are skipped.
+ *
+ * - ctx must be fresh and have the same configuration as src
+ *   (same logic, architecture, mode, and options)
+ *
+ * The function returns -1 on error, 0 otherwise.
+ *
+ * Error report:
+ * - if ctx uses MCSAT or one of the automatic difference-logic solvers
+ *   code = CTX_OPERATION_NOT_SUPPORTED
+ * - if ctx is not fresh, or src has no snapshot, or ctx and src have
+ *   different configurations
+ *   code = CTX_INVALID_OPERATION
+ */
+__YICES_DLLSPEC__ extern int32_t yices_assert_snapshot(context_t *ctx, context_t *src);
+
+
 /*
  * Check satisfiability: check whether the assertions stored in ctx
  * are satisfiable.
@@ -3346,6 +3413,65 @@ __YICES_DLLSPEC__ extern void yices_model_collect_defined_terms(model_t *mdl, te
 
 
 
+/***************************************
+ *  ONE-SHOT CHECKS AND QUERY CACHE    *
+ **************************************/
+
+/*
+ * Check whether the conjunction of formulas f[0 ... n-1] is satisfiable
+ * - logic = SMT-LIB name of a logic (e.g., "QF_LIA") or NULL
+ * - model = optional pointer to a model
+ *
+ * This creates a one-shot context for the given logic, asserts
+ * f[0 ... n-1] in that context, and checks satisfiability using the
+ * default search parameters. If logic is NULL, the default
+ * configuration is used (all solvers).
+ *
+ * If the query cache is enabled (see yices_set_query_cache_size) and
+ * the same formulas (in any order) were checked before for the same
+ * logic, then the result is taken from the cache.
+ *
+ * The function returns the status (STATUS_SAT, STATUS_UNSAT, STATUS_UNKNOWN,
+ * or STATUS_INTERRUPTED) or STATUS_ERROR if something goes wrong.
+ * If the status is STATUS_SAT and model != NULL, a new model is
+ * stored in *model. It must be deleted by the caller using yices_free_model.
+ * A model taken from the cache assigns a value to the uninterpreted
+ * terms that have a value in the original model.
+ *
+ * Error report:
+ * - as in yices_assert_formulas if one of the f[i] is invalid or not Boolean
+ * - code = CTX_UNKNOWN_LOGIC if logic is not a valid name
+ * - code = CTX_LOGIC_NOT_SUPPORTED if logic is not supported
+ * - other codes as in yices_assert_formulas if f[0 ... n-1] can't be
+ *   asserted in a context for logic
+ */
+__YICES_DLLSPEC__ extern smt_status_t yices_check_formulas(const term_t f[], uint32_t n, const char *logic, model_t **model);
+
+
+/*
+ * Set the size limit of the query cache to nbytes
+ * - nbytes = 0 disables the cache (this is the default)
+ * - if the cache uses more than nbytes, it is emptied
+ * - when the cache is full, all its entries are removed
+ *
+ * The terms stored in the cache (formulas and model values) are kept
+ * alive by the garbage collector. Disable the cache to release them.
+ */
+__YICES_DLLSPEC__ extern void yices_set_query_cache_size(uint64_t nbytes);
+
+
+/*
+ * Query cache statistics:
+ * - hits = number of queries answered from the cache
+ * - misses = number of queries not found in the cache
+ * - entries = number of entries in the cache
+ * - nbytes = memory used by the cache
+ * Any of these pointers can be NULL.
+ */
+__YICES_DLLSPEC__ extern void yices_get_query_cache_stats(uint64_t *hits, uint64_t *misses, uint32_t *entries, uint64_t *nbytes);
+
+
+
 /***********************
  *  VALUES IN A MODEL  *
  **********************/
@@ -25,6 +25,7 @@
 #include "mcsat/tracing.h"
 
 #include "utils/int_array_sort2.h"
+#include "mcsat/utils/int_mset.h"
 #include "mcsat/utils/scope_holder.h"
 
 typedef struct {
@@ -68,6 +69,10 @@ typedef struct {
   /** Size of the propagated vector */
   uint32_t propagated_size;
 
+  /** Glue computation: level l was seen if level_stamp[l] == glue_stamp */
+  ivector_t level_stamp;
+  uint32_t glue_stamp;
+
   /** Next index of the trail to process */
   uint32_t trail_i;
 
@@ -91,6 +96,8 @@ typedef struct {
 
     /** Limit on lemma clauses before we ask for gc */
     uint32_t lemma_limit_init;
+    /** Lemmas with glue up to this are always kept */
+    uint32_t lemma_glue_keep;
     /** Increase of the lemma limit after gc */
     float lemma_limit_factor;
 
@@ -126,6 +133,45 @@ void bool_plugin_heuristics_init(bool_plugin_t* bp) {
   // Clause database compact
   bp->heuristic_params.lemma_limit_init = 1000;
   bp->heuristic_params.lemma_limit_factor = 1.02;
+  bp->heuristic_params.lemma_glue_keep = 2;
+}
+
+/**
+ * Number of distinct levels of the assigned literals of the clause.
+ */
+static
+uint32_t bool_plugin_clause_glue(bool_plugin_t* bp, const mcsat_clause_t* clause) {
+  uint32_t i, glue, level;
+  ivector_t* stamp;
+  variable_t x;
+
+  stamp = &bp->level_stamp;
+
+  // New stamp, on overflow reset all the stamps
+  bp->glue_stamp ++;
+  if (bp->glue_stamp == 0) {
+    for (i = 0; i < stamp->size; ++ i) {
+      stamp->data[i] = 0;
+    }
+    bp->glue_stamp = 1;
+  }
+
+  glue = 0;
+  for (i = 0; i < clause->size; ++ i) {
+    x = literal_get_variable(clause->literals[i]);
+    if (trail_has_value(bp->ctx->trail, x)) {
+      level = trail_get_level(bp->ctx->trail, x);
+      while (stamp->size <= level) {
+        ivector_push(stamp, 0);
+      }
+      if ((uint32_t) stamp->data[level] != bp->glue_stamp) {
+        stamp->data[level] = (int32_t) bp->glue_stamp;
+        glue ++;
+      }
+    }
+  }
+
+  return glue;
 }
 
 static
@@ -142,6 +188,8 @@ void bool_plugin_construct(plugin_t* plugin, plugin_context_t* ctx) {
   bcp_watch_manager_construct(&bp->wlm);
   init_ivector(&bp->reason, 0);
   init_ivector(&bp->propagated, 0);
+  init_ivector(&bp->level_stamp, 0);
+  bp->glue_stamp = 0;
 
   bp->trail_i = 0;
   bp->propagated_size = 0;
@@ -173,6 +221,7 @@ void bool_plugin_destruct(plugin_t* plugin) {
   bcp_watch_manager_destruct(&bp->wlm);
   delete_ivector(&bp->reason);
   delete_ivector(&bp->propagated);
+  delete_ivector(&bp->level_stamp);
   scope_holder_destruct(&bp->scope);
   // DESTRUCTED ON DEMAND: gc_info_destruct(&bp->gc_clauses);
 }
@@ -355,6 +404,11 @@ int bool_plugin_attach_clause(bool_plugin_t* bp, clause_ref_t c_ref, trail_token
     propagation_level = -1;
   }
 
+  // Lemmas get their initial glue
+  if (clause_get_tag(c)->type == CLAUSE_LEMMA) {
+    clause_get_tag(c)->glue = bool_plugin_clause_glue(bp, c);
+  }
+
   // Attach the two first literals
   // ~c[0], ~c[1], i.e. when c[0] or c[1] become false we do something
   if (c->size == 2) {
@@ -399,9 +453,17 @@ void bool_plugin_rescale_clause_scores(bool_plugin_t* bp) {
 static
 void bool_plugin_bump_clause(bool_plugin_t* bp, const mcsat_clause_t* clause) {
   mcsat_clause_tag_t* tag;
+  uint32_t glue;
 
   tag = clause_get_tag(clause);
   if (tag->type == CLAUSE_LEMMA) {
+    // Update the glue if it's better now
+    if (tag->glue > bp->heuristic_params.lemma_glue_keep) {
+      glue = bool_plugin_clause_glue(bp, clause);
+      if (glue < tag->glue) {
+        tag->glue = glue;
+      }
+    }
     // Bump
     tag->score += bp->heuristic_params.clause_score_bump_factor;
     // If over the limit, normalize
@@ -805,6 +867,10 @@ bool bool_plugin_clause_compare_for_removal(void *data, clause_ref_t c1, clause_
   assert(c1_tag->type == CLAUSE_LEMMA);
   assert(c2_tag->type == CLAUSE_LEMMA);
 
+  // Lower glue first, then higher score
+  if (c1_tag->glue != c2_tag->glue) {
+    return c1_tag->glue < c2_tag->glue;
+  }
   return c1_tag->score > c2_tag->score;
 }
 
@@ -813,7 +879,7 @@ void bool_plugin_gc_mark(plugin_t* plugin, gc_info_t* gc_vars) {
   bool_plugin_t* bp = (bool_plugin_t*) plugin;
   clause_db_t* db = &bp->clause_db;
 
-  uint32_t i;
+  uint32_t i, keep;
   variable_t var;
   clause_ref_t clause_ref;
 
@@ -822,11 +888,20 @@ void bool_plugin_gc_mark(plugin_t* plugin, gc_info_t* gc_vars) {
     // Construct the gc info (destructed in collect())
     gc_info_construct(&bp->gc_clauses, clause_ref_null, false);
 
-    // Sort the lemmas based on scores
+    // Sort the lemmas based on glue and scores
     int_array_sort2(bp->lemmas.data, bp->lemmas.size, (void*) db, bool_plugin_clause_compare_for_removal);
 
-    // Mark all the variables in half of lemmas as used
-    for (i = 0; i < bp->lemmas.size / 2; ++ i) {
+    // Keep all lemmas with small glue, and half of the rest
+    for (i = 0; i < bp->lemmas.size; ++ i) {
+      clause_ref = bp->lemmas.data[i];
+      assert(clause_db_is_clause(db, clause_ref, true));
+      if (clause_db_get_tag(db, clause_ref)->glue > bp->heuristic_params.lemma_glue_keep) {
+        break;
+      }
+      gc_info_mark(&bp->gc_clauses, clause_ref);
+    }
+    keep = i + (bp->lemmas.size - i) / 2;
+    for (; i < keep; ++ i) {
       clause_ref = bp->lemmas.data[i];
       assert(clause_db_is_clause(db, clause_ref, true));
       gc_info_mark(&bp->gc_clauses, clause_ref);
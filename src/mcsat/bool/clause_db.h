@@ -51,8 +51,12 @@ typedef struct {
   union {
     /** The variable that is defined */
     variable_t var;
-    /** The score of the variable */
-    float score;
+    struct {
+      /** The score of the lemma */
+      float score;
+      /** Number of distinct decision levels in the lemma (LBD) */
+      uint32_t glue;
+    };
   };
 
 } mcsat_clause_tag_t;
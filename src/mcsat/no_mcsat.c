@@ -44,6 +44,9 @@ void mcsat_reset(mcsat_solver_t *mcsat) {
 void mcsat_clear(mcsat_solver_t* mcsat) {
 }
 
+void mcsat_clear_unsat(mcsat_solver_t* mcsat) {
+}
+
 void mcsat_push(mcsat_solver_t *mcsat) {
 }
 
@@ -54,7 +57,10 @@ int32_t mcsat_assert_formulas(mcsat_solver_t *mcsat, uint32_t n, const term_t *f
   return 0;
 }
 
-void mcsat_solve(mcsat_solver_t *mcsat, const param_t *params) {
+void mcsat_solve(mcsat_solver_t *mcsat, const param_t *params, uint32_t n, const term_t *a) {
+}
+
+void mcsat_build_unsat_core(mcsat_solver_t *mcsat, ivector_t *v) {
 }
 
 void mcsat_set_tracer(mcsat_solver_t *mcsat, tracer_t *tracer) {
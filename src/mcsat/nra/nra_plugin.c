@@ -66,6 +66,7 @@ void nra_plugin_stats_init(nra_plugin_t* nra) {
   nra->stats.evaluations = statistics_new_uint32(nra->ctx->stats, "mcsat::nra::evaluations");
   nra->stats.constraint_regular = statistics_new_uint32(nra->ctx->stats, "mcsat::nra::constraints_regular");
   nra->stats.constraint_root = statistics_new_uint32(nra->ctx->stats, "mcsat::nra::constraints_root");
+  nra->stats.psc_cache_hits = statistics_new_uint32(nra->ctx->stats, "mcsat::nra::psc_cache_hits");
 }
 
 static
@@ -112,6 +113,9 @@ void nra_plugin_construct(plugin_t* plugin, plugin_context_t* ctx) {
   // Feasible sets
   nra->feasible_set_db = feasible_set_db_new(ctx);
 
+  // Projection cache
+  nra->psc_cache = psc_cache_new();
+
   // lipoly init
   nra->lp_data.lp_var_db = lp_variable_db_new();
   nra->lp_data.lp_var_order = lp_variable_order_new();
@@ -204,6 +208,8 @@ void nra_plugin_destruct(plugin_t* plugin) {
 
   feasible_set_db_delete(nra->feasible_set_db);
 
+  psc_cache_delete(nra->psc_cache);
+
   lp_polynomial_context_detach(nra->lp_data.lp_ctx);
   lp_variable_order_detach(nra->lp_data.lp_var_order);
   lp_variable_db_detach(nra->lp_data.lp_var_db);
@@ -22,6 +22,7 @@
 #include "libpoly_utils.h"
 
 #include "utils/int_hash_map.h"
+#include "utils/hash_functions.h"
 #include "utils/pointer_vectors.h"
 #include "mcsat/tracing.h"
 #include "terms/term_manager.h"
@@ -30,6 +31,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <poly/poly.h>
 #include <poly/polynomial_hash_set.h>
@@ -65,6 +67,161 @@ void psc_buffer_delete(lp_polynomial_t** psc_buffer, uint32_t psc_buffer_size) {
   safe_free(psc_buffer);
 }
 
+/*
+ * CACHE OF PSC SEQUENCES
+ */
+
+/**
+ * Entry of the cache: the psc of (p, q) with respect to x. The psc is a
+ * polynomial in the variables below x, and it doesn't depend on the order
+ * of those variables, so entries stay valid when the order changes (they
+ * are only used again if x is the top variable of both p and q).
+ */
+typedef struct psc_cache_entry_s {
+  /** Hash of the key */
+  uint32_t hash;
+  /** The key: variable and polynomials */
+  lp_variable_t x;
+  lp_polynomial_t* p;
+  lp_polynomial_t* q;
+  /** The psc sequence */
+  lp_polynomial_t** psc;
+  uint32_t psc_size;
+} psc_cache_entry_t;
+
+struct psc_cache_s {
+  /** Hash table of entries (open addressing, size is a power of 2) */
+  psc_cache_entry_t** data;
+  uint32_t size;
+  uint32_t nelems;
+};
+
+#define PSC_CACHE_DEFAULT_SIZE 64
+#define PSC_CACHE_MAX_ELEMS    8192
+
+psc_cache_t* psc_cache_new(void) {
+  psc_cache_t* cache = safe_malloc(sizeof(psc_cache_t));
+  cache->size = PSC_CACHE_DEFAULT_SIZE;
+  cache->nelems = 0;
+  cache->data = safe_malloc(cache->size * sizeof(psc_cache_entry_t*));
+  memset(cache->data, 0, cache->size * sizeof(psc_cache_entry_t*));
+  return cache;
+}
+
+static
+void psc_cache_entry_delete(psc_cache_entry_t* entry) {
+  uint32_t i;
+  lp_polynomial_delete(entry->p);
+  lp_polynomial_delete(entry->q);
+  for (i = 0; i < entry->psc_size; ++ i) {
+    lp_polynomial_delete(entry->psc[i]);
+  }
+  safe_free(entry->psc);
+  safe_free(entry);
+}
+
+static
+void psc_cache_reset(psc_cache_t* cache) {
+  uint32_t i;
+  for (i = 0; i < cache->size; ++ i) {
+    if (cache->data[i] != NULL) {
+      psc_cache_entry_delete(cache->data[i]);
+      cache->data[i] = NULL;
+    }
+  }
+  cache->nelems = 0;
+}
+
+void psc_cache_delete(psc_cache_t* cache) {
+  psc_cache_reset(cache);
+  safe_free(cache->data);
+  safe_free(cache);
+}
+
+static inline
+uint32_t psc_cache_hash(lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q) {
+  return jenkins_hash_triple(x, lp_polynomial_hash(p), lp_polynomial_hash(q), 0x3a1f2c9d);
+}
+
+static
+psc_cache_entry_t* psc_cache_find(const psc_cache_t* cache, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q) {
+  uint32_t mask, i, h;
+  psc_cache_entry_t* entry;
+
+  h = psc_cache_hash(x, p, q);
+  mask = cache->size - 1;
+  for (i = h & mask; ; i = (i + 1) & mask) {
+    entry = cache->data[i];
+    if (entry == NULL) {
+      return NULL;
+    }
+    if (entry->hash == h && entry->x == x && lp_polynomial_eq(entry->p, p) && lp_polynomial_eq(entry->q, q)) {
+      return entry;
+    }
+  }
+}
+
+static
+void psc_cache_insert(psc_cache_entry_t** data, uint32_t size, psc_cache_entry_t* entry) {
+  uint32_t mask, i;
+
+  mask = size - 1;
+  for (i = entry->hash & mask; data[i] != NULL; i = (i + 1) & mask) {
+  }
+  data[i] = entry;
+}
+
+static
+void psc_cache_extend(psc_cache_t* cache) {
+  uint32_t i, new_size;
+  psc_cache_entry_t** new_data;
+
+  new_size = 2 * cache->size;
+  new_data = safe_malloc(new_size * sizeof(psc_cache_entry_t*));
+  memset(new_data, 0, new_size * sizeof(psc_cache_entry_t*));
+  for (i = 0; i < cache->size; ++ i) {
+    if (cache->data[i] != NULL) {
+      psc_cache_insert(new_data, new_size, cache->data[i]);
+    }
+  }
+  safe_free(cache->data);
+  cache->data = new_data;
+  cache->size = new_size;
+}
+
+/**
+ * Add a copy of psc[0 ... psc_size-1] as the psc of (p, q) w.r.t. x. If the
+ * cache is full, it's emptied first. Returns the new entry.
+ */
+static
+psc_cache_entry_t* psc_cache_add(psc_cache_t* cache, lp_variable_t x, const lp_polynomial_t* p, const lp_polynomial_t* q,
+    lp_polynomial_t** psc, uint32_t psc_size) {
+  uint32_t i;
+  psc_cache_entry_t* entry;
+
+  if (cache->nelems >= PSC_CACHE_MAX_ELEMS) {
+    psc_cache_reset(cache);
+  } else if (4 * (cache->nelems + 1) > 3 * cache->size) {
+    psc_cache_extend(cache);
+  }
+
+  entry = safe_malloc(sizeof(psc_cache_entry_t));
+  entry->hash = psc_cache_hash(x, p, q);
+  entry->x = x;
+  entry->p = lp_polynomial_new_copy(p);
+  entry->q = lp_polynomial_new_copy(q);
+  entry->psc = safe_malloc(psc_size * sizeof(lp_polynomial_t*));
+  for (i = 0; i < psc_size; ++ i) {
+    entry->psc[i] = lp_polynomial_new_copy(psc[i]);
+  }
+  entry->psc_size = psc_size;
+
+  psc_cache_insert(cache->data, cache->size, entry);
+  cache->nelems ++;
+
+  return entry;
+}
+
 
 struct lp_projection_map_struct {
 
@@ -676,17 +833,25 @@ void lp_projection_map_add_psc(lp_projection_map_t* map, lp_polynomial_t*** poly
   size_t q_deg = lp_polynomial_degree(q);
 
   uint32_t psc_size = p_deg > q_deg ? q_deg + 1 : p_deg + 1;
-  polynomial_buffer_ensure_size(polynomial_buffer, polynomial_buffer_size, psc_size, map->ctx);
 
-  // Get the psc
-  lp_polynomial_psc(*polynomial_buffer, p, q);
+  // Get the psc (from the cache if we computed it in an earlier conflict)
+  psc_cache_entry_t* psc = psc_cache_find(map->nra->psc_cache, x, p, q);
+  if (psc == NULL) {
+    polynomial_buffer_ensure_size(polynomial_buffer, polynomial_buffer_size, psc_size, map->ctx);
+    lp_polynomial_psc(*polynomial_buffer, p, q);
+    psc = psc_cache_add(map->nra->psc_cache, x, p, q, *polynomial_buffer, psc_size);
+  } else {
+    (*map->nra->stats.psc_cache_hits) ++;
+  }
+  assert(psc->psc_size == psc_size);
+
   // Add the initial sequence of the psc
   uint32_t psc_i;
   for (psc_i = 0; psc_i < psc_size; ++ psc_i) {
     // Add it
-    lp_projection_map_add(map, (*polynomial_buffer)[psc_i]);
+    lp_projection_map_add(map, psc->psc[psc_i]);
     // If it doesn't vanish we're done
-    if (lp_polynomial_sgn((*polynomial_buffer)[psc_i], map->m)) {
+    if (lp_polynomial_sgn(psc->psc[psc_i], map->m)) {
       break;
     }
   }
@@ -21,6 +21,12 @@
 #include "nra_plugin_internal.h"
 #include "utils/int_vectors.h"
 
+/** Allocate a new cache of psc sequences */
+psc_cache_t* psc_cache_new(void);
+
+/** Delete the cache */
+void psc_cache_delete(psc_cache_t* cache);
+
 /**
  * Explain the core in the conflict. Core is a set of constraint variables,
  * and conflict will a set if terms.
@@ -31,6 +31,7 @@
 
 typedef struct poly_constraint_db_struct poly_constraint_db_t;
 typedef struct poly_constraint_struct poly_constraint_t;
+typedef struct psc_cache_s psc_cache_t;
 
 struct nra_plugin_s {
 
@@ -81,6 +82,7 @@ struct nra_plugin_s {
     uint32_t* evaluations;
     uint32_t* constraint_regular;
     uint32_t* constraint_root;
+    uint32_t* psc_cache_hits;
   } stats;
 
   /** Database of polynomial constraints */
@@ -89,6 +91,9 @@ struct nra_plugin_s {
   /** Map from variables to their feasible sets */
   feasible_set_db_t* feasible_set_db;
 
+  /** Cache of psc computations used in explanations (kept across conflicts) */
+  psc_cache_t* psc_cache;
+
   /** Data related to libpoly */
   struct {
 
@@ -24,6 +24,9 @@
 #include <poly/variable_db.h>
 #include <poly/variable_list.h>
 #include <poly/feasibility_set.h>
+#include <poly/interval.h>
+#include <poly/polynomial.h>
+#include <poly/rational.h>
 
 /**
  * A constraint of the form sgn(p(x)) = sgn_conition.
@@ -258,6 +261,149 @@ uint32_t poly_constraint_get_root_index(const poly_constraint_t* cstr) {
   return cstr->root_index;
 }
 
+/**
+ * Negation of the sign condition.
+ */
+static
+lp_sign_condition_t sign_condition_negate(lp_sign_condition_t sgn_condition) {
+  switch (sgn_condition) {
+  case LP_SGN_LT_0: return LP_SGN_GE_0;
+  case LP_SGN_LE_0: return LP_SGN_GT_0;
+  case LP_SGN_EQ_0: return LP_SGN_NE_0;
+  case LP_SGN_NE_0: return LP_SGN_EQ_0;
+  case LP_SGN_GT_0: return LP_SGN_LE_0;
+  case LP_SGN_GE_0: return LP_SGN_LT_0;
+  default:
+    assert(false);
+    return sgn_condition;
+  }
+}
+
+/**
+ * Feasible set {x | x < r} (or x <= r if closed) or {x | x > r} (or x >= r
+ * if closed), with a rational bound r.
+ */
+static
+lp_feasibility_set_t* feasible_set_new_ray(const lp_value_t* r, bool below, bool closed) {
+  lp_value_t inf;
+  lp_interval_t I;
+  lp_feasibility_set_t* result;
+
+  if (below) {
+    lp_value_construct(&inf, LP_VALUE_MINUS_INFINITY, 0);
+    lp_interval_construct(&I, &inf, 1, r, !closed);
+  } else {
+    lp_value_construct(&inf, LP_VALUE_PLUS_INFINITY, 0);
+    lp_interval_construct(&I, r, !closed, &inf, 1);
+  }
+  result = lp_feasibility_set_new_from_interval(&I);
+  lp_interval_destruct(&I);
+  lp_value_destruct(&inf);
+
+  return result;
+}
+
+/**
+ * Fast path for constraints a*x + b ~ 0 where a and b evaluate to rationals
+ * in the model (this covers all linear constraints and all constraints that
+ * are linear in the top variable after the model substitution). The feasible
+ * set is built from the rational root -b/a directly, without root isolation,
+ * and all bounds stay rational.
+ *
+ * Returns NULL if the fast path doesn't apply.
+ */
+static
+lp_feasibility_set_t* poly_constraint_get_feasible_set_linear(const poly_constraint_t* cstr, const lp_assignment_t* m, bool negated) {
+
+  const lp_polynomial_t* p = cstr->polynomial;
+  if (lp_polynomial_degree(p) != 1) {
+    return NULL;
+  }
+
+  lp_feasibility_set_t* feasible = NULL;
+
+  const lp_polynomial_context_t* ctx = lp_polynomial_get_context(p);
+  lp_polynomial_t* coeff = lp_polynomial_new(ctx);
+  lp_polynomial_get_coefficient(coeff, p, 1);
+  lp_value_t* a_value = lp_polynomial_evaluate(coeff, m);
+  lp_polynomial_get_coefficient(coeff, p, 0);
+  lp_value_t* b_value = lp_polynomial_evaluate(coeff, m);
+  lp_polynomial_delete(coeff);
+
+  if (lp_value_is_rational(a_value) && lp_value_is_rational(b_value)) {
+
+    lp_rational_t a, b;
+    lp_rational_construct(&a);
+    lp_rational_construct(&b);
+    lp_value_get_rational(a_value, &a);
+    lp_value_get_rational(b_value, &b);
+
+    lp_sign_condition_t sgn_condition = negated ? sign_condition_negate(cstr->sgn_condition) : cstr->sgn_condition;
+    int a_sgn = lp_rational_sgn(&a);
+
+    if (a_sgn == 0) {
+      // Constant polynomial b: all or nothing
+      if (lp_sign_condition_consistent(sgn_condition, lp_rational_sgn(&b))) {
+        feasible = lp_feasibility_set_new_full();
+      } else {
+        feasible = lp_feasibility_set_new_empty();
+      }
+    } else {
+      // Root r = -b/a, and sgn(a*x + b) = sgn(a)*sgn(x - r)
+      lp_rational_t root;
+      lp_rational_construct(&root);
+      lp_rational_div(&root, &b, &a);
+      lp_rational_neg(&root, &root);
+      lp_value_t r;
+      lp_value_construct(&r, LP_VALUE_RATIONAL, &root);
+
+      // Negative sign of p is below the root if a > 0
+      bool neg_below = a_sgn > 0;
+      switch (sgn_condition) {
+      case LP_SGN_LT_0:
+        feasible = feasible_set_new_ray(&r, neg_below, false);
+        break;
+      case LP_SGN_LE_0:
+        feasible = feasible_set_new_ray(&r, neg_below, true);
+        break;
+      case LP_SGN_GT_0:
+        feasible = feasible_set_new_ray(&r, !neg_below, false);
+        break;
+      case LP_SGN_GE_0:
+        feasible = feasible_set_new_ray(&r, !neg_below, true);
+        break;
+      case LP_SGN_EQ_0: {
+        lp_interval_t I;
+        lp_interval_construct_point(&I, &r);
+        feasible = lp_feasibility_set_new_from_interval(&I);
+        lp_interval_destruct(&I);
+        break;
+      }
+      case LP_SGN_NE_0: {
+        feasible = feasible_set_new_ray(&r, true, false);
+        lp_feasibility_set_t* above = feasible_set_new_ray(&r, false, false);
+        lp_feasibility_set_add(feasible, above);
+        lp_feasibility_set_delete(above);
+        break;
+      }
+      default:
+        assert(false);
+      }
+
+      lp_value_destruct(&r);
+      lp_rational_destruct(&root);
+    }
+
+    lp_rational_destruct(&a);
+    lp_rational_destruct(&b);
+  }
+
+  lp_value_delete(a_value);
+  lp_value_delete(b_value);
+
+  return feasible;
+}
+
 lp_feasibility_set_t* poly_constraint_get_feasible_set(const poly_constraint_t* cstr, const lp_assignment_t* m, bool negated) {
 
   lp_feasibility_set_t* feasible  = 0;
@@ -271,8 +417,12 @@ lp_feasibility_set_t* poly_constraint_get_feasible_set(const poly_constraint_t*
       feasible = lp_polynomial_root_constraint_get_feasible_set(cstr->polynomial, cstr->root_index, cstr->sgn_condition, negated, m);
     }
   } else {
-    // Get the polynomial feasible set
-    feasible = lp_polynomial_constraint_get_feasible_set(cstr->polynomial, cstr->sgn_condition, negated, m);
+    // Try the rational fast path first
+    feasible = poly_constraint_get_feasible_set_linear(cstr, m, negated);
+    if (feasible == NULL) {
+      // Get the polynomial feasible set
+      feasible = lp_polynomial_constraint_get_feasible_set(cstr->polynomial, cstr->sgn_condition, negated, m);
+    }
   }
 
   return feasible;
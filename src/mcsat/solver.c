@@ -136,6 +136,21 @@ struct mcsat_solver_s {
   /** List of assertions (positive variables). */
   ivector_t assertion_vars;
 
+  /** Assumptions of the current check (terms as given by the user) */
+  ivector_t assumptions;
+
+  /** Preprocessed assumptions (literals) */
+  ivector_t assumption_lits;
+
+  /** Variables of the preprocessed assumptions (positive variables) */
+  ivector_t assumption_vars;
+
+  /** Number of decision levels above base that are assumption decisions */
+  uint32_t assumption_levels;
+
+  /** Assumptions in the unsat core (if unsat because of the assumptions) */
+  ivector_t assumptions_core;
+
   /** The trail */
   mcsat_trail_t* trail;
 
@@ -255,6 +270,7 @@ void mcsat_heuristics_init(mcsat_solver_t* mcsat) {
   mcsat->heuristic_params.lemma_restart_weight_type = LEMMA_WEIGHT_SIZE;
   mcsat->heuristic_params.random_decision_freq = 0;
   mcsat->heuristic_params.random_decision_seed = 0;
+  var_queue_set_vmtf(&mcsat->var_queue, mcsat->ctx->mcsat_options.var_order_vmtf);
 }
 
 bool mcsat_evaluates(const mcsat_evaluator_interface_t* self, term_t t, int_mset_t* vars, mcsat_value_t* value) {
@@ -638,6 +654,13 @@ void mcsat_construct(mcsat_solver_t* mcsat, context_t* ctx) {
   // List of assertions
   init_ivector(&mcsat->assertion_vars, 0);
 
+  // Assumptions
+  init_ivector(&mcsat->assumptions, 0);
+  init_ivector(&mcsat->assumption_lits, 0);
+  init_ivector(&mcsat->assumption_vars, 0);
+  mcsat->assumption_levels = 0;
+  init_ivector(&mcsat->assumptions_core, 0);
+
   // The trail
   mcsat->trail = safe_malloc(sizeof(mcsat_trail_t));
   trail_construct(mcsat->trail, mcsat->var_db);
@@ -712,6 +735,10 @@ void mcsat_destruct(mcsat_solver_t* mcsat) {
   delete_int_queue(&mcsat->registration_queue);
   delete_int_hset(&mcsat->registration_cache);
   delete_ivector(&mcsat->assertion_vars);
+  delete_ivector(&mcsat->assumptions);
+  delete_ivector(&mcsat->assumption_lits);
+  delete_ivector(&mcsat->assumption_vars);
+  delete_ivector(&mcsat->assumptions_core);
   trail_destruct(mcsat->trail);
   safe_free(mcsat->trail);
   variable_db_destruct(mcsat->var_db);
@@ -883,6 +910,20 @@ void mcsat_clear(mcsat_solver_t* mcsat) {
   mcsat->status = STATUS_IDLE;
 }
 
+void mcsat_clear_unsat(mcsat_solver_t* mcsat) {
+  // Only unsat because of the assumptions if there is a core
+  if (mcsat->status == STATUS_UNSAT && mcsat->assumptions_core.size > 0) {
+    ivector_reset(&mcsat->assumptions_core);
+    mcsat_clear(mcsat);
+  }
+}
+
+void mcsat_build_unsat_core(mcsat_solver_t* mcsat, ivector_t* v) {
+  assert(mcsat->status == STATUS_UNSAT);
+  ivector_reset(v);
+  ivector_add(v, mcsat->assumptions_core.data, mcsat->assumptions_core.size);
+}
+
 /**
  * Get the indices of the plugins that claim to own the term t by type.
  */
@@ -999,6 +1040,11 @@ void mcsat_gc(mcsat_solver_t* mcsat, bool mark_internal) {
     }
   }
 
+  // Mark the assumption variables (only set during search)
+  for (i = 0; i < mcsat->assumption_vars.size; ++ i) {
+    gc_info_mark(&gc_vars, mcsat->assumption_vars.data[i]);
+  }
+
   // Mark the top decision variable if any
   if (mcsat->top_decision_var != variable_null) {
     gc_info_mark(&gc_vars, mcsat->top_decision_var);
@@ -1105,6 +1151,12 @@ void mcsat_backtrack_to(mcsat_solver_t* mcsat, uint32_t level) {
     // Pop the plugins
     mcsat_pop_internal(mcsat);
   }
+
+  // Keep only the assumption decisions that are still on the trail
+  if (level < mcsat->trail->decision_level_base + mcsat->assumption_levels) {
+    assert(level >= mcsat->trail->decision_level_base);
+    mcsat->assumption_levels = level - mcsat->trail->decision_level_base;
+  }
 }
 
 static
@@ -1680,6 +1732,124 @@ bool mcsat_decide(mcsat_solver_t* mcsat) {
   return var != variable_null;
 }
 
+/**
+ * Setup the assumptions a[0] ... a[n-1] for the next search. The assumptions
+ * are preprocessed as assertions, and any definitions that the preprocessor
+ * introduces (e.g. purification) are asserted at base level.
+ */
+static
+void mcsat_set_assumptions(mcsat_solver_t* mcsat, uint32_t n, const term_t* a) {
+
+  uint32_t i;
+  term_t lit, lit_pos;
+  variable_t lit_pos_var;
+  ivector_t definitions;
+
+  assert(trail_is_at_base_level(mcsat->trail));
+
+  ivector_reset(&mcsat->assumptions);
+  ivector_reset(&mcsat->assumption_lits);
+  ivector_reset(&mcsat->assumption_vars);
+  mcsat->assumption_levels = 0;
+
+  init_ivector(&definitions, 0);
+  for (i = 0; i < n; ++ i) {
+    lit = preprocessor_apply(&mcsat->preprocessor, a[i], &definitions);
+    lit_pos = unsigned_term(lit);
+    lit_pos_var = variable_db_get_variable(mcsat->var_db, lit_pos);
+    mcsat_process_registeration_queue(mcsat);
+    ivector_push(&mcsat->assumptions, a[i]);
+    ivector_push(&mcsat->assumption_lits, lit);
+    ivector_push(&mcsat->assumption_vars, lit_pos_var);
+  }
+  if (definitions.size > 0) {
+    mcsat_assert_formulas(mcsat, definitions.size, definitions.data);
+  }
+  delete_ivector(&definitions);
+}
+
+/**
+ * Collect the unsat core when assumption i is false: the assumption itself,
+ * and all the assumptions that were decided at or below its level.
+ *
+ * The reasons of the propagation that made assumption i false are not
+ * analyzed, so the core is the whole prefix of decided assumptions, even
+ * if only some of them are needed.
+ */
+static
+void mcsat_build_assumptions_core(mcsat_solver_t* mcsat, uint32_t i) {
+
+  uint32_t j, level;
+  variable_t var;
+
+  ivector_reset(&mcsat->assumptions_core);
+  ivector_push(&mcsat->assumptions_core, mcsat->assumptions.data[i]);
+
+  level = trail_get_level(mcsat->trail, mcsat->assumption_vars.data[i]);
+  for (j = 0; j < mcsat->assumption_vars.size; ++ j) {
+    var = mcsat->assumption_vars.data[j];
+    if (j != i && trail_has_value(mcsat->trail, var) &&
+        trail_get_assignment_type(mcsat->trail, var) == DECISION &&
+        trail_get_level(mcsat->trail, var) <= level) {
+      ivector_push(&mcsat->assumptions_core, mcsat->assumptions.data[j]);
+    }
+  }
+}
+
+/**
+ * Decide the next assumption. Assumptions are decided in order, each on its
+ * own level, directly above the base level (they are decided again after
+ * backtracking or restarts). Returns true if the trail has changed, or if
+ * the assumptions are inconsistent (status is then set to UNSAT).
+ */
+static
+bool mcsat_decide_assumption(mcsat_solver_t* mcsat) {
+
+  uint32_t i, assumptions_top;
+  term_t lit;
+  variable_t var;
+  bool value;
+
+  assumptions_top = mcsat->trail->decision_level_base + mcsat->assumption_levels;
+
+  for (i = 0; i < mcsat->assumption_vars.size; ++ i) {
+    var = mcsat->assumption_vars.data[i];
+    lit = mcsat->assumption_lits.data[i];
+    value = is_pos_term(lit);
+
+    if (trail_has_value(mcsat->trail, var) && trail_get_boolean_value(mcsat->trail, var) == value) {
+      // Already satisfied
+      continue;
+    }
+
+    if (mcsat->trail->decision_level > assumptions_top) {
+      // Other decisions are in the way, redo the assumptions
+      mcsat_backtrack_to(mcsat, assumptions_top);
+      return true;
+    }
+
+    if (trail_has_value(mcsat->trail, var)) {
+      // False because of the assertions and the previous assumptions
+      if (trace_enabled(mcsat->ctx->trace, "mcsat::assumptions")) {
+        mcsat_trace_printf(mcsat->ctx->trace, "assumption is false:\n");
+        trace_term_ln(mcsat->ctx->trace, mcsat->terms, mcsat->assumptions.data[i]);
+      }
+      mcsat_build_assumptions_core(mcsat, i);
+      mcsat->status = STATUS_UNSAT;
+      return true;
+    }
+
+    // Decide it on a new level
+    mcsat_push_internal(mcsat);
+    trail_add_decision(mcsat->trail, var, value ? &mcsat_value_true : &mcsat_value_false, MCSAT_MAX_PLUGINS);
+    mcsat->assumption_levels ++;
+    (*mcsat->solver_stats.decisions)++;
+    return true;
+  }
+
+  return false;
+}
+
 typedef struct {
   uint32_t u, v;
   uint32_t restart_threshold;
@@ -1705,29 +1875,12 @@ void luby_next(luby_t* luby) {
   luby->restart_threshold = luby->v * luby->interval;
 }
 
-void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params) {
+static
+void mcsat_search(mcsat_solver_t* mcsat) {
 
   uint32_t restart_resource;
   luby_t luby;
 
-  // If we're already unsat, just return
-  if (!trail_is_consistent(mcsat->trail)) {
-    mcsat->status = STATUS_UNSAT;
-    return;
-  }
-
-  if (trace_enabled(mcsat->ctx->trace, "mcsat::solve")) {
-    static int count = 0;
-    mcsat_trace_printf(mcsat->ctx->trace, "solve %d\n", count ++);
-  }
-
-  // Remember existing terms
-  mcsat->terms_size_on_solver_entry = mcsat->terms->nelems;
-
-  // Initialize for search
-  mcsat_heuristics_init(mcsat);
-  mcsat_notify_plugins(mcsat, MCSAT_SOLVER_START);
-
   // Initialize the Luby sequence with interval 10
   restart_resource = 0;
   luby_init(&luby, mcsat->heuristic_params.restart_interval);
@@ -1757,6 +1910,14 @@ void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params) {
       continue;
     }
 
+    // Assumptions are decided before anything else
+    if (mcsat_decide_assumption(mcsat)) {
+      if (mcsat->status == STATUS_UNSAT) {
+        return;
+      }
+      continue;
+    }
+
     // Time to make a decision
     if (!mcsat_decide(mcsat)) {
       if (!trail_is_consistent(mcsat->trail)) {
@@ -1793,6 +1954,42 @@ void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params) {
   }
 }
 
+void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params, uint32_t n, const term_t *assumptions) {
+
+  // No core from previous checks
+  ivector_reset(&mcsat->assumptions_core);
+
+  // If we're already unsat, just return
+  if (!trail_is_consistent(mcsat->trail)) {
+    mcsat->status = STATUS_UNSAT;
+    return;
+  }
+
+  if (trace_enabled(mcsat->ctx->trace, "mcsat::solve")) {
+    static int count = 0;
+    mcsat_trace_printf(mcsat->ctx->trace, "solve %d\n", count ++);
+  }
+
+  // Remember existing terms
+  mcsat->terms_size_on_solver_entry = mcsat->terms->nelems;
+
+  // Initialize for search
+  mcsat_heuristics_init(mcsat);
+  mcsat_notify_plugins(mcsat, MCSAT_SOLVER_START);
+
+  // Setup the assumptions (only live during search)
+  mcsat_set_assumptions(mcsat, n, assumptions);
+
+  if (trail_is_consistent(mcsat->trail)) {
+    mcsat_search(mcsat);
+  } else {
+    mcsat->status = STATUS_UNSAT;
+  }
+
+  ivector_reset(&mcsat->assumption_lits);
+  ivector_reset(&mcsat->assumption_vars);
+}
+
 void mcsat_set_tracer(mcsat_solver_t* mcsat, tracer_t* tracer) {
   uint32_t i;
   mcsat_plugin_context_t* ctx;
@@ -53,6 +53,12 @@ void mcsat_reset(mcsat_solver_t* mcsat);
  */
 void mcsat_clear(mcsat_solver_t* mcsat);
 
+/*
+ * Clear after an unsat check with assumptions: if the solver is unsat
+ * only because of the assumptions, go back to IDLE.
+ */
+void mcsat_clear_unsat(mcsat_solver_t* mcsat);
+
 /*
  * Push the user context.
  */
@@ -76,12 +82,25 @@ void mcsat_pop(mcsat_solver_t* mcsat);
 int32_t mcsat_assert_formulas(mcsat_solver_t *mcsat, uint32_t n, const term_t *f);
 
 /*
- * Solve asserted constraints.
+ * Solve asserted constraints under assumptions a[0] ... a[n-1].
  *
  * @param params Heuristic parameters. If params is NULL, the default settings
  *               are used.
+ * @param n Number of assumptions (can be 0)
+ * @param a Assumptions: Boolean terms that are decided before anything else
+ */
+void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params, uint32_t n, const term_t *a);
+
+/*
+ * Build an unsat core after an unsat check: subset of the assumptions that
+ * is inconsistent with the assertions. The result is stored in v (it's
+ * empty if the assertions alone are inconsistent).
+ *
+ * The core is not minimal: it's the assumption found false, together with
+ * all the assumptions decided at or below the level where it became false,
+ * whether or not they contribute to the conflict.
  */
-void mcsat_solve(mcsat_solver_t* mcsat, const param_t *params);
+void mcsat_build_unsat_core(mcsat_solver_t* mcsat, ivector_t* v);
 
 /*
  * Add the model to the yices model
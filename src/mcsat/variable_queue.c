@@ -53,6 +53,9 @@ void var_queue_construct(var_queue_t *queue) {
 
   queue->act_increment = INIT_VAR_ACTIVITY_INCREMENT;
   queue->inv_act_decay = 1/VAR_DECAY_FACTOR;
+
+  queue->vmtf = false;
+  queue->vmtf_stamp = 0.0;
 }
 
 void var_queue_extend(var_queue_t *queue, uint32_t n) {
@@ -236,7 +239,11 @@ void var_queue_bump_variable(var_queue_t *heap, variable_t x, uint32_t factor) {
   assert(factor > 0);
   assert(x < heap->size);
 
-  if ((heap->activity[x] += factor * heap->act_increment) > VAR_ACTIVITY_THRESHOLD) {
+  if (heap->vmtf) {
+    // move to front: newest bump gets the highest score (factor is ignored)
+    heap->vmtf_stamp += 1.0;
+    heap->activity[x] = heap->vmtf_stamp;
+  } else if ((heap->activity[x] += factor * heap->act_increment) > VAR_ACTIVITY_THRESHOLD) {
     var_queue_rescale_activities(heap);
   }
 
@@ -276,7 +283,27 @@ int var_queue_cmp_variables(var_queue_t *queue, variable_t x, variable_t y) {
 
 /** Decay. */
 void var_queue_decay_activities(var_queue_t *queue) {
-  queue->act_increment *= queue->inv_act_decay;
+  if (!queue->vmtf) {
+    queue->act_increment *= queue->inv_act_decay;
+  }
+}
+
+/** Set the VMTF mode. */
+void var_queue_set_vmtf(var_queue_t *queue, bool vmtf) {
+  uint32_t i;
+  double max;
+
+  if (vmtf && !queue->vmtf) {
+    // start the timestamps above all current activities
+    max = 0.0;
+    for (i = 0; i < queue->size; ++ i) {
+      if (queue->activity[i] > max) {
+        max = queue->activity[i];
+      }
+    }
+    queue->vmtf_stamp = max;
+  }
+  queue->vmtf = vmtf;
 }
 
 /** Sweep the variables */
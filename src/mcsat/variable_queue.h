@@ -59,6 +59,10 @@ typedef struct var_queue_s {
   uint32_t vmax;
   double act_increment;
   double inv_act_decay;
+  /** Move-to-front mode: bumping moves the variable to the top */
+  bool vmtf;
+  /** Timestamp for move-to-front bumps */
+  double vmtf_stamp;
 } var_queue_t;
 
 /**
@@ -106,6 +110,14 @@ void var_queue_set_activity(var_queue_t* queue, variable_t x, double a);
 /** Decay. */
 void var_queue_decay_activities(var_queue_t *queue);
 
+/**
+ * Switch between VSIDS (default) and VMTF (variable move-to-front) mode. In
+ * VMTF mode, bumping a variable gives it a fresh timestamp larger than all
+ * other activities, so the most recently bumped variable is decided first,
+ * and decay is a no-op.
+ */
+void var_queue_set_vmtf(var_queue_t *queue, bool vmtf);
+
 /** Compare two variables by score */
 int var_queue_cmp_variables(var_queue_t *queue, variable_t x, variable_t y);
 
@@ -25,6 +25,7 @@
 
 #include "model/model_eval.h"
 #include "terms/bv64_constants.h"
+#include "utils/memalloc.h"
 
 
 /*
@@ -45,19 +46,75 @@ void init_evaluator(evaluator_t *eval, model_t *model) {
   eval->vtbl = &model->vtbl;
 
   init_int_hmap(&eval->cache, 0); // use the default hmap size
+  eval->shared = NULL;
+  init_int_hmap(&eval->bv64_index, 0);
+  eval->bv64_word = NULL;
+  eval->bv64_nwords = 0;
+  eval->bv64_size = 0;
   init_istack(&eval->stack);
   // eval->env is not initialized
 }
 
 
+/*
+ * Shared evaluator: attach the model's cache
+ */
+void init_shared_evaluator(evaluator_t *eval, model_t *model) {
+  init_evaluator(eval, model);
+  eval->shared = model_get_eval_cache(model);
+}
+
+
+/*
+ * Copy the content of eval->cache into eval->shared
+ * - skip temporary objects since they can be deleted
+ * - to bound memory use, the shared cache is emptied first if the
+ *   copy could make it larger than MODEL_EVAL_CACHE_MAX. Nothing is
+ *   copied if eval->cache is larger than that.
+ */
+static void eval_export_cache(evaluator_t *eval) {
+  int_hmap_t *shared;
+  int_hmap_pair_t *r, *p;
+  uint32_t n;
+  int32_t tmp;
+
+  n = eval->cache.nelems;
+  if (n > MODEL_EVAL_CACHE_MAX) {
+    return;
+  }
+  if (eval->shared->nelems + n > MODEL_EVAL_CACHE_MAX) {
+    assert(eval->shared == eval->model->eval_cache);
+    model_shrink_eval_cache(eval->model);
+  }
+
+  shared = eval->shared;
+  tmp = eval->vtbl->first_tmp;
+  r = int_hmap_first_record(&eval->cache);
+  while (r != NULL) {
+    if (tmp < 0 || r->val < tmp) {
+      p = int_hmap_get(shared, r->key);
+      p->val = r->val;
+    }
+    r = int_hmap_next_record(&eval->cache, r);
+  }
+}
+
+
 /*
  * Delete caches and stack
  */
 void delete_evaluator(evaluator_t *eval) {
+  if (eval->shared != NULL) {
+    eval_export_cache(eval);
+    eval->shared = NULL;
+  }
   eval->model = NULL;
   eval->terms = NULL;
   eval->vtbl = NULL;
   delete_int_hmap(&eval->cache);
+  delete_int_hmap(&eval->bv64_index);
+  safe_free(eval->bv64_word);
+  eval->bv64_word = NULL;
   delete_istack(&eval->stack);
 }
 
@@ -68,6 +125,8 @@ void delete_evaluator(evaluator_t *eval) {
  */
 void reset_evaluator(evaluator_t *eval) {
   int_hmap_reset(&eval->cache);
+  int_hmap_reset(&eval->bv64_index);
+  eval->bv64_nwords = 0;
   reset_istack(&eval->stack);
   value_table_start_tmp(eval->vtbl);
 }
@@ -84,6 +143,9 @@ static value_t eval_cached_value(evaluator_t *eval, term_t t) {
   assert(good_term(eval->terms, t));
 
   r = int_hmap_find(&eval->cache, t);
+  if (r == NULL && eval->shared != NULL) {
+    r = int_hmap_find(eval->shared, t);
+  }
   if (r == NULL) {
     return null_value;
   } else {
@@ -117,6 +179,13 @@ static void eval_cache_map(evaluator_t *eval, term_t t, value_t v) {
  */
 static value_t eval_term(evaluator_t *eval, term_t t);
 
+/*
+ * Compute the value of a bitvector term t of at most 64 bits
+ * - return the value as a normalized 64bit word
+ * - raise an exception if t can't be evaluated
+ */
+static uint64_t eval_bv64_word(evaluator_t *eval, term_t t);
+
 /*
  * Attempt to get a rational value for v
  * - fails with a longjmp if v is an algebraic number
@@ -486,6 +555,11 @@ static value_t eval_bit(evaluator_t *eval, select_term_t *select) {
   value_bv_t *bv;
   bool b;
 
+  if (term_bitsize(eval->terms, select->arg) <= 64) {
+    b = tst_bit64(eval_bv64_word(eval, select->arg), select->idx);
+    return vtbl_mk_bool(eval->vtbl, b);
+  }
+
   v = eval_term(eval, select->arg);
   bv = vtbl_bitvector(eval->vtbl, v);
   assert(select->idx < bv->nbits);
@@ -759,6 +833,10 @@ static value_t eval_bveq(evaluator_t *eval, composite_term_t *eq) {
 
   assert(eq->arity == 2);
 
+  if (term_bitsize(eval->terms, eq->arg[0]) <= 64) {
+    return vtbl_mk_bool(eval->vtbl, eval_bv64_word(eval, eq->arg[0]) == eval_bv64_word(eval, eq->arg[1]));
+  }
+
   v1 = eval_term(eval, eq->arg[0]);
   v2 = eval_term(eval, eq->arg[1]);
   assert(object_is_bitvector(eval->vtbl, v1) &&
@@ -774,6 +852,10 @@ static value_t eval_bvge(evaluator_t *eval, composite_term_t *ge) {
 
   assert(ge->arity == 2);
 
+  if (term_bitsize(eval->terms, ge->arg[0]) <= 64) {
+    return vtbl_mk_bool(eval->vtbl, eval_bv64_word(eval, ge->arg[0]) >= eval_bv64_word(eval, ge->arg[1]));
+  }
+
   v1 = eval_term(eval, ge->arg[0]);
   v2 = eval_term(eval, ge->arg[1]);
   bv1 = vtbl_bitvector(eval->vtbl, v1);
@@ -787,10 +869,16 @@ static value_t eval_bvge(evaluator_t *eval, composite_term_t *ge) {
 static value_t eval_bvsge(evaluator_t *eval, composite_term_t *sge) {
   value_t v1, v2;
   value_bv_t *bv1, *bv2;
+  uint32_t n;
   bool test;
 
   assert(sge->arity == 2);
 
+  n = term_bitsize(eval->terms, sge->arg[0]);
+  if (n <= 64) {
+    return vtbl_mk_bool(eval->vtbl, signed64_ge(eval_bv64_word(eval, sge->arg[0]), eval_bv64_word(eval, sge->arg[1]), n));
+  }
+
   v1 = eval_term(eval, sge->arg[0]);
   v2 = eval_term(eval, sge->arg[1]);
   bv1 = vtbl_bitvector(eval->vtbl, v1);
@@ -890,35 +978,217 @@ static uint64_t bvobj_to_uint64(value_bv_t *o) {
 
 
 /*
- * Bitvector polynomial: 64bit coefficients
+ * WORD-LEVEL EVALUATION OF SMALL BITVECTORS
+ */
+
+/*
+ * Store w as the value of t in eval->bv64_word
+ */
+static void eval_bv64_store(evaluator_t *eval, term_t t, uint64_t w) {
+  int_hmap_pair_t *r;
+  uint32_t i, n;
+
+  i = eval->bv64_nwords;
+  n = eval->bv64_size;
+  if (i == n) {
+    n = (n == 0) ? 64 : n + (n >> 1);
+    if (n > UINT32_MAX/sizeof(uint64_t)) {
+      out_of_memory();
+    }
+    eval->bv64_word = (uint64_t *) safe_realloc(eval->bv64_word, n * sizeof(uint64_t));
+    eval->bv64_size = n;
+  }
+  eval->bv64_word[i] = w;
+  eval->bv64_nwords = i + 1;
+
+  r = int_hmap_get(&eval->bv64_index, t);
+  assert(r->val < 0);
+  r->val = i;
+}
+
+/*
+ * Power product p of nbits: product of x^k in 64bit arithmetic
  */
-static value_t eval_bv64_poly(evaluator_t *eval, bvpoly64_t *p) {
+static uint64_t eval_bv64_pprod_word(evaluator_t *eval, pprod_t *p, uint32_t nbits) {
+  uint64_t prod, x;
+  uint32_t i, n, k;
+
+  prod = 1;
+  n = p->len;
+  for (i=0; i<n; i++) {
+    x = eval_bv64_word(eval, p->prod[i].var);
+    k = p->prod[i].exp;
+    // prod := prod * x^k
+    while (k > 0) {
+      if (k & 1) prod *= x;
+      x *= x;
+      k >>= 1;
+    }
+  }
+
+  return norm64(prod, nbits);
+}
+
+static uint64_t eval_bv64_poly_word(evaluator_t *eval, bvpoly64_t *p) {
   uint64_t sum;
-  uint32_t i, n, nbits;
+  uint32_t i, n;
   term_t t;
-  value_t v;
-
-  nbits = p->bitsize;
-  assert(0 < nbits && nbits <= 64);
 
   sum = 0;
-
   n = p->nterms;
   for (i=0; i<n; i++) {
     t = p->mono[i].var;
     if (t == const_idx) {
       sum += p->mono[i].coeff;
     } else {
-      v = eval_term(eval, t);
-      sum += p->mono[i].coeff * bvobj_to_uint64(vtbl_bitvector(eval->vtbl, v));
+      sum += p->mono[i].coeff * eval_bv64_word(eval, t);
     }
   }
 
-  // convert sum to an object
-  sum = norm64(sum, nbits);
-  v = vtbl_mk_bv_from_bv64(eval->vtbl, nbits, sum);
+  return norm64(sum, p->bitsize);
+}
 
-  return v;
+static uint64_t eval_bv64_array_word(evaluator_t *eval, composite_term_t *array) {
+  uint64_t w;
+  uint32_t i, n;
+  value_t v;
+
+  w = 0;
+  n = array->arity;
+  assert(n <= 64);
+  for (i=0; i<n; i++) {
+    v = eval_term(eval, array->arg[i]);
+    if (is_true(eval->vtbl, v)) {
+      w = set_bit64(w, i);
+    }
+  }
+
+  return w;
+}
+
+static uint64_t eval_bv64_ite_word(evaluator_t *eval, composite_term_t *ite) {
+  value_t c;
+
+  assert(ite->arity == 3);
+
+  c = eval_term(eval, ite->arg[0]);
+  if (is_true(eval->vtbl, c)) {
+    return eval_bv64_word(eval, ite->arg[1]);
+  } else {
+    assert(is_false(eval->vtbl, c));
+    return eval_bv64_word(eval, ite->arg[2]);
+  }
+}
+
+/*
+ * Binary operators: divisions and shifts
+ */
+static uint64_t eval_bv64_binop_word(evaluator_t *eval, term_kind_t kind, composite_term_t *app, uint32_t n) {
+  uint64_t x, y;
+
+  assert(app->arity == 2);
+
+  x = eval_bv64_word(eval, app->arg[0]);
+  y = eval_bv64_word(eval, app->arg[1]);
+
+  switch (kind) {
+  case BV_DIV:  return bvconst64_udiv2z(x, y, n);
+  case BV_REM:  return bvconst64_urem2z(x, y, n);
+  case BV_SDIV: return bvconst64_sdiv2z(x, y, n);
+  case BV_SREM: return bvconst64_srem2z(x, y, n);
+  case BV_SMOD: return bvconst64_smod2z(x, y, n);
+  case BV_SHL:  return bvconst64_lshl(x, y, n);
+  case BV_LSHR: return bvconst64_lshr(x, y, n);
+  case BV_ASHR: return bvconst64_ashr(x, y, n);
+  default:
+    assert(false);
+    longjmp(eval->env, MDL_EVAL_INTERNAL_ERROR);
+  }
+}
+
+static uint64_t eval_bv64_word(evaluator_t *eval, term_t t) {
+  term_table_t *terms;
+  int_hmap_pair_t *r;
+  term_kind_t kind;
+  uint32_t n;
+  uint64_t w;
+  value_t v;
+
+  terms = eval->terms;
+
+  assert(is_pos_term(t) && is_bitvector_term(terms, t));
+
+  n = term_bitsize(terms, t);
+  assert(0 < n && n <= 64);
+
+  /*
+   * Check the model, the cache, then the words.
+   */
+  v = model_find_term_value(eval->model, t);
+  if (v == null_value) {
+    v = eval_cached_value(eval, t);
+  }
+  if (v != null_value) {
+    return bvobj_to_uint64(vtbl_bitvector(eval->vtbl, v));
+  }
+
+  r = int_hmap_find(&eval->bv64_index, t);
+  if (r != NULL) {
+    return eval->bv64_word[r->val];
+  }
+
+  kind = term_kind(terms, t);
+  switch (kind) {
+  case BV64_CONSTANT:
+    w = bvconst64_term_desc(terms, t)->value;
+    break;
+
+  case BV64_POLY:
+    w = eval_bv64_poly_word(eval, bvpoly64_term_desc(terms, t));
+    break;
+
+  case POWER_PRODUCT:
+    w = eval_bv64_pprod_word(eval, pprod_term_desc(terms, t), n);
+    break;
+
+  case BV_ARRAY:
+    w = eval_bv64_array_word(eval, bvarray_term_desc(terms, t));
+    break;
+
+  case ITE_TERM:
+  case ITE_SPECIAL:
+    w = eval_bv64_ite_word(eval, ite_term_desc(terms, t));
+    break;
+
+  case BV_DIV:
+  case BV_REM:
+  case BV_SDIV:
+  case BV_SREM:
+  case BV_SMOD:
+  case BV_SHL:
+  case BV_LSHR:
+  case BV_ASHR:
+    w = eval_bv64_binop_word(eval, kind, composite_term_desc(terms, t), n);
+    break;
+
+  default:
+    // uninterpreted terms, function applications, etc.
+    v = eval_term(eval, t);
+    return bvobj_to_uint64(vtbl_bitvector(eval->vtbl, v));
+  }
+
+  eval_bv64_store(eval, t, w);
+
+  return w;
+}
+
+
+/*
+ * Value of a bitvector term of at most 64 bits: only the final
+ * object is created in vtbl.
+ */
+static value_t eval_bv64_term(evaluator_t *eval, term_t t) {
+  return vtbl_mk_bv_from_bv64(eval->vtbl, term_bitsize(eval->terms, t), eval_bv64_word(eval, t));
 }
 
 
@@ -1323,39 +1593,75 @@ static value_t eval_term(evaluator_t *eval, term_t t) {
 	break;
 
       case BV_ARRAY:
-        v = eval_bv_array(eval, bvarray_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_array(eval, bvarray_term_desc(terms, t));
+        }
         break;
 
       case BV_DIV:
-        v = eval_bv_div(eval, bvdiv_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_div(eval, bvdiv_term_desc(terms, t));
+        }
         break;
 
       case BV_REM:
-        v = eval_bv_rem(eval, bvrem_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_rem(eval, bvrem_term_desc(terms, t));
+        }
         break;
 
       case BV_SDIV:
-        v = eval_bv_sdiv(eval, bvsdiv_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_sdiv(eval, bvsdiv_term_desc(terms, t));
+        }
         break;
 
       case BV_SREM:
-        v = eval_bv_srem(eval, bvsrem_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_srem(eval, bvsrem_term_desc(terms, t));
+        }
         break;
 
       case BV_SMOD:
-        v = eval_bv_smod(eval, bvsmod_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_smod(eval, bvsmod_term_desc(terms, t));
+        }
         break;
 
       case BV_SHL:
-        v = eval_bv_shl(eval, bvshl_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_shl(eval, bvshl_term_desc(terms, t));
+        }
         break;
 
       case BV_LSHR:
-        v = eval_bv_lshr(eval, bvlshr_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_lshr(eval, bvlshr_term_desc(terms, t));
+        }
         break;
 
       case BV_ASHR:
-        v = eval_bv_ashr(eval, bvashr_term_desc(terms, t));
+        if (term_bitsize(terms, t) <= 64) {
+          v = eval_bv64_term(eval, t);
+        } else {
+          v = eval_bv_ashr(eval, bvashr_term_desc(terms, t));
+        }
         break;
 
       case BV_EQ_ATOM:
@@ -1380,7 +1686,11 @@ static value_t eval_term(evaluator_t *eval, term_t t) {
 
       case POWER_PRODUCT:
         if (is_bitvector_term(terms, t)) {
-          v = eval_bv_pprod(eval, pprod_term_desc(terms, t), term_bitsize(terms, t));
+          if (term_bitsize(terms, t) <= 64) {
+            v = eval_bv64_term(eval, t);
+          } else {
+            v = eval_bv_pprod(eval, pprod_term_desc(terms, t), term_bitsize(terms, t));
+          }
         } else {
           assert(is_arithmetic_term(terms, t));
           v = eval_arith_pprod(eval, pprod_term_desc(terms, t));
@@ -1392,7 +1702,7 @@ static value_t eval_term(evaluator_t *eval, term_t t) {
         break;
 
       case BV64_POLY:
-        v = eval_bv64_poly(eval, bvpoly64_term_desc(terms, t));
+        v = eval_bv64_term(eval, t);
         break;
 
       case BV_POLY:
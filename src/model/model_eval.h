@@ -56,6 +56,14 @@ enum {
  *   (term table and value table are extracted from
  *    model when the evaluator is initialized)
  * - cache: keeps track of the value of evaluated terms
+ * - shared: pointer to the model's evaluation cache or NULL
+ *   (if non-NULL, it's searched after cache and the content of
+ *    cache is copied into shared when the evaluator is deleted)
+ * - bv64_index, bv64_word: values of bitvector terms of at most
+ *   64 bits, computed directly as machine words. For such a term t,
+ *   bv64_word[bv64_index(t)] is t's value (normalized). These words are
+ *   used for intermediate terms so that no objects are created in vtbl
+ *   except for the terms whose value is requested.
  * - env: jump buffer for error handling
  * - stack of integer arrays
  */
@@ -64,6 +72,11 @@ typedef struct evaluator_s {
   term_table_t *terms;
   value_table_t *vtbl;
   int_hmap_t cache;
+  int_hmap_t *shared;
+  int_hmap_t bv64_index;
+  uint64_t *bv64_word;
+  uint32_t bv64_nwords;
+  uint32_t bv64_size;
   int_stack_t stack;
   jmp_buf env;
 } evaluator_t;
@@ -80,8 +93,22 @@ typedef struct evaluator_s {
 extern void init_evaluator(evaluator_t *eval, model_t *model);
 
 
+/*
+ * Initialization for a shared evaluator:
+ * - this evaluator reuses the values computed by previous shared
+ *   evaluators for the same model (stored in model->eval_cache)
+ *   and adds its own values to model->eval_cache when it's deleted.
+ * - it must not be used with evaluator_collect_cached_terms or
+ *   eval_record_useful_terms: terms found in the model's cache are
+ *   not copied into eval->cache.
+ */
+extern void init_shared_evaluator(evaluator_t *eval, model_t *model);
+
+
 /*
  * Deletion: free all memory
+ * - for a shared evaluator, the cached values are first exported
+ *   to model->eval_cache
  */
 extern void delete_evaluator(evaluator_t *eval);
 
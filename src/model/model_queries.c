@@ -43,7 +43,7 @@ value_t model_get_term_value(model_t *mdl, term_t t) {
 
   v = model_find_term_value(mdl, t);
   if (v == null_value) {
-    init_evaluator(&evaluator, mdl);
+    init_shared_evaluator(&evaluator, mdl);
     v = eval_in_model(&evaluator, t);
     delete_evaluator(&evaluator);
   }
@@ -109,7 +109,7 @@ int32_t evaluate_term_array(model_t *mdl, uint32_t n, const term_t a[], value_t
    * Stop on the first error if any
    */
   if (k > 0) {
-    init_evaluator(&evaluator, mdl);
+    init_shared_evaluator(&evaluator, mdl);
     for (i=0; i<n; i++) {
       if (b[i] < 0) {
 	v = eval_in_model(&evaluator, a[i]);
@@ -144,7 +144,7 @@ bool formulas_hold_in_model(model_t *mdl, uint32_t n, const term_t a[], int32_t
   *code = 0;
 
   vtbl = model_get_vtbl(mdl);
-  init_evaluator(&evaluator, mdl);
+  init_shared_evaluator(&evaluator, mdl);
   for (i=0; i<n; i++) {
     assert(is_boolean_term(mdl->terms, a[i]));
     v = eval_in_model(&evaluator, a[i]);
@@ -166,19 +166,25 @@ bool formulas_hold_in_model(model_t *mdl, uint32_t n, const term_t a[], int32_t
 
 
 /*
- * Filter used below:
+ * Filters used below:
  * - aux is a term table
  * - t is relevant if it's uninterpreted and has a name
+ * - t is uninterpreted if it's an uninterpreted term (named or not)
  */
 static bool term_is_relevant(void *aux, term_t t) {
   return is_pos_term(t) && term_kind(aux, t) == UNINTERPRETED_TERM && term_name(aux, t) != NULL;
 }
 
+static bool term_is_uninterpreted(void *aux, term_t t) {
+  return is_pos_term(t) && term_kind(aux, t) == UNINTERPRETED_TERM;
+}
+
 /*
  * Get a list of all variables that have a value in the model
+ * and satisfy the filter
  * - these variables are store into vector *v
  */
-void model_get_relevant_vars(model_t *mdl, ivector_t *v) {
+static void collect_vars_in_model(model_t *mdl, model_filter_t filter, ivector_t *v) {
   evaluator_t eval;
 
   ivector_reset(v);
@@ -202,7 +208,7 @@ void model_get_relevant_vars(model_t *mdl, ivector_t *v) {
      *
      * The second pass makes sure that y is found.
      */
-    model_collect_terms(mdl, true, mdl->terms, term_is_relevant, v);
+    model_collect_terms(mdl, true, mdl->terms, filter, v);
 
     // compute their values
     eval_terms_in_model(&eval, v->data, v->size);
@@ -210,12 +216,20 @@ void model_get_relevant_vars(model_t *mdl, ivector_t *v) {
     // second pass: collect all uninterpreted terms that
     // have a value in model or in the evaluator.
     ivector_reset(v);
-    model_collect_terms(mdl, false, mdl->terms, term_is_relevant, v);
-    evaluator_collect_cached_terms(&eval, mdl->terms, term_is_relevant, v);
+    model_collect_terms(mdl, false, mdl->terms, filter, v);
+    evaluator_collect_cached_terms(&eval, mdl->terms, filter, v);
     delete_evaluator(&eval);
 
   } else {
-    model_collect_terms(mdl, false, mdl->terms, term_is_relevant, v);
+    model_collect_terms(mdl, false, mdl->terms, filter, v);
   }
 }
 
+void model_get_relevant_vars(model_t *mdl, ivector_t *v) {
+  collect_vars_in_model(mdl, term_is_relevant, v);
+}
+
+void model_get_all_vars(model_t *mdl, ivector_t *v) {
+  collect_vars_in_model(mdl, term_is_uninterpreted, v);
+}
+
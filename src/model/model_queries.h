@@ -72,10 +72,15 @@ extern bool formulas_hold_in_model(model_t *mdl, uint32_t n, const term_t a[], i
 
 
 /*
- * Get a list of all variables that have a value in the model
+ * Get a list of all named variables that have a value in the model
  * - the variables are added to vector *v
  */
 extern void model_get_relevant_vars(model_t *mdl, ivector_t *v);
 
+/*
+ * Same thing for all variables (named or not)
+ */
+extern void model_get_all_vars(model_t *mdl, ivector_t *v);
+
 
 #endif /* __MODEL_QUERIES_H */
@@ -59,8 +59,10 @@ void init_model(model_t *model, term_table_t *terms, bool keep_subst) {
 
   init_int_hmap(&model->map, 0);
   model->alias_map = NULL;
+  model->eval_cache = NULL;
   model->terms = terms;
   model->has_alias = keep_subst;
+  model->gc_dirty = true;
 
 }
 
@@ -76,6 +78,50 @@ void delete_model(model_t *model) {
     safe_free(model->alias_map);
     model->alias_map = NULL;
   }
+  if (model->eval_cache != NULL) {
+    delete_int_hmap(model->eval_cache);
+    safe_free(model->eval_cache);
+    model->eval_cache = NULL;
+  }
+}
+
+
+/*
+ * Empty the evaluation cache: it's called when the model changes
+ * (cached values may depend on default values for unmapped terms).
+ */
+static void model_clear_eval_cache(model_t *model) {
+  if (model->eval_cache != NULL && model->eval_cache->nelems > 0) {
+    int_hmap_reset(model->eval_cache);
+  }
+}
+
+
+/*
+ * Empty the evaluation cache and free most of its memory
+ */
+void model_shrink_eval_cache(model_t *model) {
+  if (model->eval_cache != NULL) {
+    delete_int_hmap(model->eval_cache);
+    init_int_hmap(model->eval_cache, 0);
+  }
+}
+
+
+/*
+ * Get the evaluation cache
+ */
+int_hmap_t *model_get_eval_cache(model_t *model) {
+  int_hmap_t *cache;
+
+  cache = model->eval_cache;
+  if (cache == NULL) {
+    cache = (int_hmap_t *) safe_malloc(sizeof(int_hmap_t));
+    init_int_hmap(cache, 0); // default size
+    model->eval_cache = cache;
+  }
+  model->gc_dirty = true;
+  return cache;
 }
 
 
@@ -142,6 +188,8 @@ void model_map_term(model_t *model, term_t t, value_t v) {
   r = int_hmap_get(&model->map, t);
   assert(r->val < 0);
   r->val = v;
+  model_clear_eval_cache(model);
+  model->gc_dirty = true;
 
   // copy t's name if any
   name = term_name(model->terms, t);
@@ -180,6 +228,8 @@ void model_add_substitution(model_t *model, term_t t, term_t u) {
   r = int_hmap_get(alias, t);
   assert(r->val < 0);
   r->val = u;
+  model_clear_eval_cache(model);
+  model->gc_dirty = true;
 }
 
 
@@ -284,10 +334,12 @@ static void mdl_mark_alias(void *aux, const int_hmap_pair_t *r) {
  *   to term_table_gc
  */
 void model_gc_mark(model_t *model) {
+  model_clear_eval_cache(model);
   int_hmap_iterate(&model->map, model->terms, mdl_mark_map);
   if (model->alias_map != NULL) {
     int_hmap_iterate(model->alias_map, model->terms, mdl_mark_alias);
   }
+  model->gc_dirty = false;
 }
 
 
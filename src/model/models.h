@@ -57,13 +57,24 @@
  * - has_alias: flag true if the model is intended to support
  *   the internal substitution table (alias_map). (NOTE: has_alias
  *   is set at construction time and it may be true even if alias_map is NULL).
+ * - eval_cache = values of terms computed by shared evaluators
+ *   (cf. model_eval.h). It's allocated on demand and emptied whenever
+ *   map or alias_map is updated, or terms may be garbage collected.
+ *   It's also emptied when it would grow beyond MODEL_EVAL_CACHE_MAX
+ *   entries.
+ * - gc_dirty: true if the model may contain terms created since the
+ *   last call to model_gc_mark.
  */
+#define MODEL_EVAL_CACHE_MAX 262144
+
 struct model_s {
   value_table_t vtbl;
   int_hmap_t map;
   int_hmap_t *alias_map;
+  int_hmap_t *eval_cache;
   term_table_t *terms;
   bool has_alias;
+  bool gc_dirty;
 };
 
 
@@ -156,12 +167,38 @@ typedef bool (*model_filter_t)(void *aux, term_t t);
 extern void model_collect_terms(model_t *model, bool all, void *aux, model_filter_t f, ivector_t *v);
 
 
+/*
+ * Get the evaluation cache of model (allocate it if needed)
+ */
+extern int_hmap_t *model_get_eval_cache(model_t *model);
+
+/*
+ * Empty the evaluation cache and shrink it to its default size
+ * - this is done automatically when an evaluator would make the
+ *   cache larger than MODEL_EVAL_CACHE_MAX (cf. model_eval.c)
+ * - it can also be called explicitly to release memory
+ * - the cache descriptor is kept so pointers to it remain valid
+ */
+extern void model_shrink_eval_cache(model_t *model);
+
+
 /*
  * Prepare for garbage collection: mark all the terms present in model
  * - all marked terms will be considered as roots on the next call
  *   to term_table_gc
+ * - the evaluation cache is emptied since the terms it contains
+ *   are not marked
  */
 extern void model_gc_mark(model_t *model);
 
+/*
+ * Check whether the model was modified or used for evaluation since
+ * the last call to model_gc_mark. If not, it can be skipped by a
+ * minor collection.
+ */
+static inline bool model_gc_dirty(model_t *model) {
+  return model->gc_dirty;
+}
+
 
 #endif /* __MODELS_H */
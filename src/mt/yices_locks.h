@@ -52,6 +52,44 @@ extern int32_t release_yices_lock(yices_lock_t* lock);
 extern void destroy_yices_lock(yices_lock_t* lock);
 
 
+/*
+ * Index of the calling thread: a thread gets the smallest index not
+ * used by any other live thread on its first call, and keeps it until
+ * it exits. When the thread exits, all registered exit handlers are
+ * called with its index, then the index is released and can be given
+ * to another thread.
+ *
+ * This is intended to give each thread a private slot in shared
+ * data structures (cf. object_stores.h).
+ */
+extern uint32_t yices_thread_index(void);
+
+
+/*
+ * Thread-exit handler: a structure that owns a private slot per thread
+ * embeds one of these and registers it. When a thread with an index
+ * exits, fun(h, i) is called for every registered handler h, where i
+ * is the index of the exiting thread. This is the place to give back
+ * what's cached in slot i.
+ * - fun is called with the handler registry locked, so it must not
+ *   register or unregister handlers
+ * - a handler must be unregistered before its owner is deleted
+ */
+typedef struct yices_thread_exit_handler_s yices_thread_exit_handler_t;
+
+typedef void (*yices_thread_exit_fun_t)(yices_thread_exit_handler_t *h, uint32_t i);
+
+struct yices_thread_exit_handler_s {
+  yices_thread_exit_fun_t fun;
+  void *data;
+  yices_thread_exit_handler_t *prev;
+  yices_thread_exit_handler_t *next;
+};
+
+extern void register_thread_exit_handler(yices_thread_exit_handler_t *h, yices_thread_exit_fun_t fun, void *data);
+extern void unregister_thread_exit_handler(yices_thread_exit_handler_t *h);
+
+
 #endif
 
 #endif /* __YICES_LOCKS_H */
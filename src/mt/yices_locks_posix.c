@@ -20,8 +20,11 @@
 #include <stdio.h>
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "yices_locks.h"
+#include "utils/memalloc.h"
 
 //I see NDEBUG and DEBUG in the code; which is it?
 #ifdef DEBUG
@@ -87,3 +90,108 @@ void destroy_yices_lock(yices_lock_t* lock){
   }
   assert(retcode == 0);
 }
+
+
+/*
+ * Thread indices:
+ * - thread_index is -1 until the thread's first call
+ * - index_used[i] is true if index i belongs to a live thread
+ *   (index_size = size of this array)
+ * - thread_key is used to get a callback when a thread exits: the value
+ *   attached to it is the thread's index + 1 (a destructor is called
+ *   only if this value is not NULL)
+ * - handlers is the sentinel of the circular list of exit handlers
+ * All of this is protected by thread_index_lock.
+ */
+static __thread int32_t thread_index = -1;
+static bool *index_used = NULL;
+static uint32_t index_size = 0;
+static pthread_key_t thread_key;
+static pthread_once_t thread_key_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t thread_index_lock = PTHREAD_MUTEX_INITIALIZER;
+static yices_thread_exit_handler_t handlers = { NULL, NULL, &handlers, &handlers };
+
+
+/*
+ * Destructor for thread_key: call the handlers then free the index
+ */
+static void release_thread_index(void *v) {
+  yices_thread_exit_handler_t *h;
+  uint32_t i;
+
+  i = (uint32_t) ((uintptr_t) v - 1);
+
+  pthread_mutex_lock(&thread_index_lock);
+  assert(i < index_size && index_used[i]);
+  for (h = handlers.next; h != &handlers; h = h->next) {
+    h->fun(h, i);
+  }
+  index_used[i] = false;
+  pthread_mutex_unlock(&thread_index_lock);
+
+  // in case the thread calls yices from another destructor
+  thread_index = -1;
+}
+
+static void create_thread_key(void) {
+  int32_t retcode = pthread_key_create(&thread_key, release_thread_index);
+  if(retcode){
+    fprintf(stderr, "yices_thread_index failed: pthread_key_create returned %d\n", retcode);
+  }
+  assert(retcode == 0);
+}
+
+/*
+ * Smallest index not in use
+ */
+static uint32_t _o_new_thread_index(void) {
+  uint32_t i, n;
+
+  for (i=0; i<index_size; i++) {
+    if (!index_used[i]) break;
+  }
+  if (i == index_size) {
+    n = (index_size == 0) ? 16 : 2 * index_size;
+    index_used = (bool *) safe_realloc(index_used, n * sizeof(bool));
+    memset(index_used + index_size, 0, (n - index_size) * sizeof(bool));
+    index_size = n;
+  }
+  index_used[i] = true;
+
+  return i;
+}
+
+uint32_t yices_thread_index(void){
+  uint32_t i;
+
+  if (thread_index < 0) {
+    pthread_once(&thread_key_once, create_thread_key);
+    pthread_mutex_lock(&thread_index_lock);
+    i = _o_new_thread_index();
+    pthread_mutex_unlock(&thread_index_lock);
+    pthread_setspecific(thread_key, (void *) ((uintptr_t) i + 1));
+    thread_index = i;
+  }
+  return (uint32_t) thread_index;
+}
+
+
+void register_thread_exit_handler(yices_thread_exit_handler_t *h, yices_thread_exit_fun_t fun, void *data){
+  h->fun = fun;
+  h->data = data;
+  pthread_mutex_lock(&thread_index_lock);
+  h->next = &handlers;
+  h->prev = handlers.prev;
+  handlers.prev->next = h;
+  handlers.prev = h;
+  pthread_mutex_unlock(&thread_index_lock);
+}
+
+void unregister_thread_exit_handler(yices_thread_exit_handler_t *h){
+  pthread_mutex_lock(&thread_index_lock);
+  h->prev->next = h->next;
+  h->next->prev = h->prev;
+  h->prev = NULL;
+  h->next = NULL;
+  pthread_mutex_unlock(&thread_index_lock);
+}
@@ -16,7 +16,13 @@
  * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <windows.h>
+
 #include "yices_locks.h"
+#include "utils/memalloc.h"
 
 // we need _WIN32_WINNT as 0x0403 or later
 
@@ -50,3 +56,95 @@ void destroy_yices_lock(yices_lock_t* lock){
   /* void return type */
   DeleteCriticalSection(lock);
 }
+
+
+/*
+ * Thread indices: same scheme as in yices_locks_posix.c, with a fiber-local
+ * storage callback instead of a pthread_key destructor.
+ * - thread_index is -1 until the thread's first call
+ * - index_used[i] is true if index i belongs to a live thread
+ * - the value attached to fls_index is the thread's index + 1
+ * All of this is protected by thread_index_lock.
+ */
+static __thread int32_t thread_index = -1;
+static bool *index_used = NULL;
+static uint32_t index_size = 0;
+static DWORD fls_index = FLS_OUT_OF_INDEXES;
+static SRWLOCK thread_index_lock = SRWLOCK_INIT;
+static yices_thread_exit_handler_t handlers = { NULL, NULL, &handlers, &handlers };
+
+
+static VOID WINAPI release_thread_index(PVOID v) {
+  yices_thread_exit_handler_t *h;
+  uint32_t i;
+
+  if (v == NULL) return;
+
+  i = (uint32_t) ((uintptr_t) v - 1);
+
+  AcquireSRWLockExclusive(&thread_index_lock);
+  assert(i < index_size && index_used[i]);
+  for (h = handlers.next; h != &handlers; h = h->next) {
+    h->fun(h, i);
+  }
+  index_used[i] = false;
+  ReleaseSRWLockExclusive(&thread_index_lock);
+
+  thread_index = -1;
+}
+
+static uint32_t _o_new_thread_index(void) {
+  uint32_t i, n;
+
+  if (fls_index == FLS_OUT_OF_INDEXES) {
+    fls_index = FlsAlloc(release_thread_index);
+    assert(fls_index != FLS_OUT_OF_INDEXES);
+  }
+
+  for (i=0; i<index_size; i++) {
+    if (!index_used[i]) break;
+  }
+  if (i == index_size) {
+    n = (index_size == 0) ? 16 : 2 * index_size;
+    index_used = (bool *) safe_realloc(index_used, n * sizeof(bool));
+    memset(index_used + index_size, 0, (n - index_size) * sizeof(bool));
+    index_size = n;
+  }
+  index_used[i] = true;
+
+  return i;
+}
+
+uint32_t yices_thread_index(void){
+  uint32_t i;
+
+  if (thread_index < 0) {
+    AcquireSRWLockExclusive(&thread_index_lock);
+    i = _o_new_thread_index();
+    ReleaseSRWLockExclusive(&thread_index_lock);
+    FlsSetValue(fls_index, (PVOID) ((uintptr_t) i + 1));
+    thread_index = i;
+  }
+  return (uint32_t) thread_index;
+}
+
+
+void register_thread_exit_handler(yices_thread_exit_handler_t *h, yices_thread_exit_fun_t fun, void *data){
+  h->fun = fun;
+  h->data = data;
+  AcquireSRWLockExclusive(&thread_index_lock);
+  h->next = &handlers;
+  h->prev = handlers.prev;
+  handlers.prev->next = h;
+  handlers.prev = h;
+  ReleaseSRWLockExclusive(&thread_index_lock);
+}
+
+void unregister_thread_exit_handler(yices_thread_exit_handler_t *h){
+  AcquireSRWLockExclusive(&thread_index_lock);
+  h->prev->next = h->next;
+  h->next->prev = h->prev;
+  h->prev = NULL;
+  h->next = NULL;
+  ReleaseSRWLockExclusive(&thread_index_lock);
+}
@@ -462,9 +462,11 @@ static void init_bv_trail(bv_trail_stack_t *stack) {
  * - ndm = number of delayed mapped variables
  * - ndb = number of delayed blasted variables
  * - bb = bitblast pointer
+ * - nl = number of lazy variables
+ * - nr = number of refined lazy variables
  */
 static void bv_trail_save(bv_trail_stack_t *stack, uint32_t nv, uint32_t na, uint32_t nb,
-                          uint32_t ns, uint32_t ndm, uint32_t ndb, uint32_t bb) {
+                          uint32_t ns, uint32_t ndm, uint32_t ndb, uint32_t bb, uint32_t nl, uint32_t nr) {
   uint32_t i, n;
 
   i = stack->top;
@@ -491,6 +493,8 @@ static void bv_trail_save(bv_trail_stack_t *stack, uint32_t nv, uint32_t na, uin
   stack->data[i].ndelayed_mapped = ndm;
   stack->data[i].ndelayed_blasted = ndb;
   stack->data[i].nbblasted = bb;
+  stack->data[i].nlazy = nl;
+  stack->data[i].nrefined = nr;
 
   stack->top = i+1;
 }
@@ -548,6 +552,8 @@ static void init_bv_stats(bv_stats_t *s) {
   s->equiv_conflicts = 0;
   s->half_equiv_lemmas = 0;
   s->interface_lemmas = 0;
+  s->lazy_vars = 0;
+  s->lazy_refinements = 0;
 }
 
 static inline void reset_bv_stats(bv_stats_t *s) {
@@ -1569,6 +1575,49 @@ static void collect_bvvar_literals(bv_solver_t *solver, thvar_t x, ivector_t *v)
 
 
 
+/*
+ * Check whether x should be bit-blasted lazily
+ * - x must be a multiplication, division, or remainder
+ * - n = bitsize of x
+ * - we don't delay x if one of its operands is a constant
+ */
+static bool bv_solver_delay_blasting(bv_solver_t *solver, thvar_t x, uint32_t n) {
+  bv_vartable_t *vtbl;
+
+  if (solver->lazy_blast_width == 0 || n < solver->lazy_blast_width || n > 64) {
+    return false;
+  }
+
+  vtbl = &solver->vtbl;
+  return !bvvar_is_const64(vtbl, vtbl->def[x].op[0]) && !bvvar_is_const64(vtbl, vtbl->def[x].op[1]);
+}
+
+
+/*
+ * Abstract x: map all its bits to fresh literals and add x to the lazy queues
+ * - u = pseudo map of x
+ * - n = bitsize of x
+ */
+static void bv_solver_abstract_variable(bv_solver_t *solver, thvar_t x, literal_t *u, uint32_t n) {
+  remap_table_t *rmap;
+  uint32_t i;
+  literal_t l;
+
+  rmap = solver->remap;
+  for (i=0; i<n; i++) {
+    l = remap_table_find(rmap, u[i]);
+    if (l == null_literal) {
+      l = bit_blaster_fresh_literal(solver->blaster);
+      remap_table_assign(rmap, u[i], l);
+    }
+  }
+
+  bv_queue_push(&solver->lazy_vars, x);
+  bv_queue_push(&solver->lazy_queue, x);
+  solver->stats.lazy_vars ++;
+}
+
+
 /*
  * Recursive bit-blasting:
  * - if x is bitblasted already: do nothing
@@ -1679,6 +1728,10 @@ static void bv_solver_bitblast_variable(bv_solver_t *solver, thvar_t x) {
         z = vtbl->def[x].op[1];
         bv_solver_bitblast_variable(solver, y);
         bv_solver_bitblast_variable(solver, z);
+        if (bv_solver_delay_blasting(solver, x, n)) {
+          bv_solver_abstract_variable(solver, x, u, n);
+          break;
+        }
         a = &solver->a_vector;
         b = &solver->b_vector;
         collect_bvvar_literals(solver, y, a);
@@ -1698,6 +1751,10 @@ static void bv_solver_bitblast_variable(bv_solver_t *solver, thvar_t x) {
         z = vtbl->def[x].op[1];
         bv_solver_bitblast_variable(solver, y);
         bv_solver_bitblast_variable(solver, z);
+        if (op == BVTAG_MUL && bv_solver_delay_blasting(solver, x, n)) {
+          bv_solver_abstract_variable(solver, x, u, n);
+          break;
+        }
         a = &solver->a_vector;
         b = &solver->b_vector;
         collect_bvvar_literals(solver, y, a);
@@ -1920,6 +1977,224 @@ bool bv_solver_compile(bv_solver_t *solver) {
 
 
 
+/**************************
+ *  LAZY BIT-BLASTING     *
+ *************************/
+
+/*
+ * Value of x in the current assignment
+ * - x must be bitblasted and have bitsize <= 64
+ * - the value is stored in *c
+ * - return false if some bit of x is unassigned
+ */
+static bool bv_solver_current_value64(bv_solver_t *solver, thvar_t x, uint64_t *c) {
+  remap_table_t *rmap;
+  literal_t *mx;
+  uint64_t v;
+  uint32_t i, n;
+  literal_t l;
+
+  assert(bvvar_is_bitblasted(&solver->vtbl, x));
+
+  rmap = solver->remap;
+  mx = bvvar_get_map(&solver->vtbl, x);
+  n = bvvar_bitsize(&solver->vtbl, x);
+  assert(mx != NULL && n <= 64);
+
+  v = 0;
+  for (i=0; i<n; i++) {
+    l = remap_table_find(rmap, mx[i]);
+    assert(l != null_literal);
+    switch (literal_value(solver->core, l)) {
+    case VAL_TRUE:
+      v |= ((uint64_t) 1) << i;
+      break;
+    case VAL_FALSE:
+      break;
+    default:
+      return false;
+    }
+  }
+
+  *c = v;
+  return true;
+}
+
+
+/*
+ * Check whether the current assignment satisfies x's definition
+ * - x must be in the lazy queue
+ */
+static bool bv_solver_lazy_var_is_consistent(bv_solver_t *solver, thvar_t x) {
+  bv_vartable_t *vtbl;
+  uint64_t a, b, c, d;
+  uint32_t n;
+
+  vtbl = &solver->vtbl;
+  if (! bv_solver_current_value64(solver, x, &c) ||
+      ! bv_solver_current_value64(solver, vtbl->def[x].op[0], &a) ||
+      ! bv_solver_current_value64(solver, vtbl->def[x].op[1], &b)) {
+    return false;
+  }
+
+  n = bvvar_bitsize(vtbl, x);
+  switch (bvvar_tag(vtbl, x)) {
+  case BVTAG_MUL:
+    d = norm64(a * b, n);
+    break;
+  case BVTAG_UDIV:
+    d = bvconst64_udiv2z(a, b, n);
+    break;
+  case BVTAG_UREM:
+    d = bvconst64_urem2z(a, b, n);
+    break;
+  case BVTAG_SDIV:
+    d = bvconst64_sdiv2z(a, b, n);
+    break;
+  case BVTAG_SREM:
+    d = bvconst64_srem2z(a, b, n);
+    break;
+  default:
+    assert(false);
+    abort();
+  }
+
+  return c == d;
+}
+
+
+/*
+ * Bitblast the definition of x
+ * - x must be in the lazy queue: its bits are already mapped to literals
+ */
+static void bv_solver_refine_lazy_var(bv_solver_t *solver, thvar_t x) {
+  bv_vartable_t *vtbl;
+  bit_blaster_t *blaster;
+  ivector_t *a, *b;
+  literal_t *u;
+  uint32_t n;
+
+  vtbl = &solver->vtbl;
+  blaster = solver->blaster;
+  assert(blaster != NULL);
+
+  a = &solver->a_vector;
+  b = &solver->b_vector;
+  collect_bvvar_literals(solver, vtbl->def[x].op[0], a);
+  collect_bvvar_literals(solver, vtbl->def[x].op[1], b);
+  u = bvvar_get_map(vtbl, x);
+  n = bvvar_bitsize(vtbl, x);
+  assert(a->size == n && b->size == n);
+
+#if TRACE
+  printf("---> BVSOLVER: refining lazy variable\n");
+  print_bv_solver_vardef(stdout, solver, x);
+  fflush(stdout);
+#endif
+
+  switch (bvvar_tag(vtbl, x)) {
+  case BVTAG_MUL:
+    bit_blaster_make_bvmul(blaster, a->data, b->data, u, n);
+    break;
+  case BVTAG_UDIV:
+    bit_blaster_make_udivision(blaster, a->data, b->data, u, NULL, n);
+    break;
+  case BVTAG_UREM:
+    bit_blaster_make_udivision(blaster, a->data, b->data, NULL, u, n);
+    break;
+  case BVTAG_SDIV:
+    bit_blaster_make_sdivision(blaster, a->data, b->data, u, NULL, n);
+    break;
+  case BVTAG_SREM:
+    bit_blaster_make_sdivision(blaster, a->data, b->data, NULL, u, n);
+    break;
+  default:
+    assert(false);
+    abort();
+  }
+
+  solver->stats.lazy_refinements ++;
+}
+
+
+/*
+ * Check all variables in the lazy queue and bitblast those whose
+ * definition is violated by the current assignment.
+ * - return the number of variables refined
+ *
+ * Refined variables are moved from lazy_queue to lazy_refined: the
+ * refinement clauses ensure that they're never violated again (until
+ * they're removed by pop, see bv_solver_restore_lazy_queue).
+ */
+static uint32_t bv_solver_refine_lazy_vars(bv_solver_t *solver) {
+  bv_queue_t *queue;
+  uint32_t i, j, n;
+  thvar_t x;
+
+  queue = &solver->lazy_queue;
+  n = queue->top;
+  j = 0;
+  for (i=0; i<n; i++) {
+    x = queue->data[i];
+    if (bv_solver_lazy_var_is_consistent(solver, x)) {
+      queue->data[j] = x;
+      j ++;
+    } else {
+      bv_solver_refine_lazy_var(solver, x);
+      bv_queue_push(&solver->lazy_refined, x);
+    }
+  }
+  queue->top = j;
+
+  return n - j;
+}
+
+
+/*
+ * Restore the lazy queues on pop
+ * - nl = number of lazy variables on entry to the current base level
+ * - nr = number of refined variables on entry to the current base level
+ * - the lazy variables created after the push are removed
+ * - the variables refined after the push go back to lazy_queue
+ */
+static void bv_solver_restore_lazy_queue(bv_solver_t *solver, uint32_t nl, uint32_t nr) {
+  bv_vartable_t *vtbl;
+  bv_queue_t *all, *refined, *queue;
+  uint32_t i;
+  thvar_t x;
+
+  all = &solver->lazy_vars;
+  refined = &solver->lazy_refined;
+  queue = &solver->lazy_queue;
+
+  assert(nl <= all->top && nr <= refined->top && nr <= nl);
+
+  if (all->top == nl && refined->top == nr) {
+    // nothing was refined or abstracted since the push: queue is unchanged
+    return;
+  }
+
+  all->top = nl;
+  refined->top = nr;
+
+  vtbl = &solver->vtbl;
+  for (i=0; i<nr; i++) {
+    bvvar_set_mark(vtbl, refined->data[i]);
+  }
+
+  reset_bv_queue(queue);
+  for (i=0; i<nl; i++) {
+    x = all->data[i];
+    if (bvvar_is_marked(vtbl, x)) {
+      bvvar_clr_mark(vtbl, x);
+    } else {
+      bv_queue_push(queue, x);
+    }
+  }
+}
+
+
+
 /************************************************
  *  VARIABLES THAT ARE EQUAL AFTER BITBLASTING  *
  ***********************************************/
@@ -7064,9 +7339,13 @@ bool bv_solver_propagate(bv_solver_t *solver) {
 }
 
 /*
- * Final check: nothing to do
+ * Final check: bitblast the lazy variables whose definition is
+ * violated by the current assignment
  */
 fcheck_code_t bv_solver_final_check(bv_solver_t *solver) {
+  if (solver->lazy_queue.top > 0 && bv_solver_refine_lazy_vars(solver) > 0) {
+    return FCHECK_CONTINUE;
+  }
   return FCHECK_SAT;
 }
 
@@ -7160,6 +7439,10 @@ void init_bv_solver(bv_solver_t *solver, smt_core_t *core, egraph_t *egraph) {
   init_bv_queue(&solver->select_queue);
   init_bv_queue(&solver->delayed_mapped);
   init_bv_queue(&solver->delayed_blasted);
+  solver->lazy_blast_width = 0;
+  init_bv_queue(&solver->lazy_vars);
+  init_bv_queue(&solver->lazy_queue);
+  init_bv_queue(&solver->lazy_refined);
   init_bv_trail(&solver->trail_stack);
 
   init_bvpoly_buffer(&solver->buffer);
@@ -7232,6 +7515,9 @@ void delete_bv_solver(bv_solver_t *solver) {
   delete_bv_queue(&solver->select_queue);
   delete_bv_queue(&solver->delayed_mapped);
   delete_bv_queue(&solver->delayed_blasted);
+  delete_bv_queue(&solver->lazy_vars);
+  delete_bv_queue(&solver->lazy_queue);
+  delete_bv_queue(&solver->lazy_refined);
   delete_bv_trail(&solver->trail_stack);
 
   delete_bvpoly_buffer(&solver->buffer);
@@ -7261,7 +7547,7 @@ void delete_bv_solver(bv_solver_t *solver) {
  * Start a new base level
  */
 void bv_solver_push(bv_solver_t *solver) {
-  uint32_t na, nv, nb, ns, ndm, ndb, bb;
+  uint32_t na, nv, nb, ns, ndm, ndb, bb, nl, nr;
 
   assert(solver->decision_level == solver->base_level &&
          all_bvvars_unmarked(solver));
@@ -7273,8 +7559,10 @@ void bv_solver_push(bv_solver_t *solver) {
   ndm = solver->delayed_mapped.top;
   ndb = solver->delayed_blasted.top;
   bb = solver->bbptr;
+  nl = solver->lazy_vars.top;
+  nr = solver->lazy_refined.top;
 
-  bv_trail_save(&solver->trail_stack, nv, na, nb, ns, ndm, ndb, bb);
+  bv_trail_save(&solver->trail_stack, nv, na, nb, ns, ndm, ndb, bb, nl, nr);
 
   mtbl_push(&solver->mtbl);
 
@@ -7423,6 +7711,13 @@ void bv_solver_pop(bv_solver_t *solver) {
   bv_solver_clean_delayed_blasted_vars(solver, top->ndelayed_blasted);
   solver->delayed_blasted.top = top->ndelayed_blasted;
 
+  /*
+   * Remove the lazy variables abstracted at this level: they are
+   * either deleted or in the delayed_blasted queue. Restore the
+   * variables refined at this level.
+   */
+  bv_solver_restore_lazy_queue(solver, top->nlazy, top->nrefined);
+
   /*
    * remove vars in the select queue
    */
@@ -7499,6 +7794,9 @@ void bv_solver_reset(bv_solver_t *solver) {
   reset_bv_queue(&solver->select_queue);
   reset_bv_queue(&solver->delayed_mapped);
   reset_bv_queue(&solver->delayed_blasted);
+  reset_bv_queue(&solver->lazy_vars);
+  reset_bv_queue(&solver->lazy_queue);
+  reset_bv_queue(&solver->lazy_refined);
   reset_bv_trail(&solver->trail_stack);
 
   reset_bvpoly_buffer(&solver->buffer, 32);
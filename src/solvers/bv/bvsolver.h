@@ -200,6 +200,19 @@ extern thvar_t bv_solver_var_compiles_to(bv_solver_t *solver, thvar_t x);
 
 
 
+/*
+ * Lazy bit-blasting: multiplications, divisions, and remainders of bitsize
+ * between n and 64 are bitblasted on demand (in final_check) rather than
+ * when the search starts.
+ * - n = 0 disables lazy bit-blasting (default)
+ * - this takes effect on the next call to bv_solver_bitblast
+ */
+static inline void bv_solver_set_lazy_blasting(bv_solver_t *solver, uint32_t n) {
+  solver->lazy_blast_width = n;
+}
+
+
+
 /****************
  *  STATISTICS  *
  ***************/
@@ -268,6 +281,17 @@ static inline uint32_t bv_solver_interface_lemmas(bv_solver_t *solver) {
   return solver->stats.interface_lemmas;
 }
 
+/*
+ * Lazy bit-blasting: number of variables abstracted and number of refinements
+ */
+static inline uint32_t bv_solver_lazy_vars(bv_solver_t *solver) {
+  return solver->stats.lazy_vars;
+}
+
+static inline uint32_t bv_solver_lazy_refinements(bv_solver_t *solver) {
+  return solver->stats.lazy_refinements;
+}
+
 
 
 /************************
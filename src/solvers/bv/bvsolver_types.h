@@ -200,7 +200,8 @@ typedef struct bv_queue_s {
  * For every push, we keep track of the number of variables and atoms
  * on entry to the new base level, the size of the bound queue, and
  * the size of the queue of select vars and delayed mapped/bitblasting vars, the
- * number of bitblasted atoms.
+ * number of bitblasted atoms, and the number of lazy variables
+ * (abstracted and refined).
  */
 typedef struct bv_trail_s {
   uint32_t nvars;
@@ -210,6 +211,8 @@ typedef struct bv_trail_s {
   uint32_t ndelayed_mapped;
   uint32_t ndelayed_blasted;
   uint32_t nbblasted;
+  uint32_t nlazy;
+  uint32_t nrefined;
 } bv_trail_t;
 
 typedef struct bv_trail_stack_s {
@@ -272,6 +275,8 @@ typedef struct bv_stats_s {
   uint32_t equiv_conflicts;
   uint32_t half_equiv_lemmas;
   uint32_t interface_lemmas;
+  uint32_t lazy_vars;
+  uint32_t lazy_refinements;
 } bv_stats_t;
 
 
@@ -350,6 +355,24 @@ typedef struct bv_solver_s {
   bv_queue_t delayed_mapped;
   bv_queue_t delayed_blasted;
 
+  /*
+   * Lazy bit-blasting:
+   * - if lazy_blast_width > 0, then multiplications, divisions, and
+   *   remainders of bitsize n with lazy_blast_width <= n <= 64 are
+   *   not bit-blasted eagerly. They are mapped to fresh literals and
+   *   added to lazy_vars and lazy_queue. Their definition is bit-blasted in
+   *   final_check, if the current assignment violates it.
+   * - lazy_vars = all the abstracted variables in creation order
+   * - lazy_queue = the abstracted variables that are not bit-blasted yet
+   * - lazy_refined = the variables bit-blasted in final_check, in order.
+   *   On pop, the variables refined after the push go back to lazy_queue
+   *   since the refinement clauses are removed.
+   */
+  uint32_t lazy_blast_width;
+  bv_queue_t lazy_vars;
+  bv_queue_t lazy_queue;
+  bv_queue_t lazy_refined;
+
   /*
    * Push/pop stack
    */
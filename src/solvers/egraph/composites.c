@@ -1188,6 +1188,7 @@ void init_congruence_table(congruence_table_t *tbl, uint32_t n) {
   }
 
   tbl->data = tmp;
+  tbl->hash = (uint32_t *) safe_malloc(n * sizeof(uint32_t));
   tbl->size = n;
   tbl->nelems = 0;
   tbl->ndeleted = 0;
@@ -1220,18 +1221,20 @@ void reset_congruence_table(congruence_table_t *tbl) {
  */
 void delete_congruence_table(congruence_table_t *tbl) {
   safe_free(tbl->data);
+  safe_free(tbl->hash);
   tbl->data = NULL;
+  tbl->hash = NULL;
   delete_sign_buffer(&tbl->buffer);
 }
 
 
 /*
- * Store composite d in a clean data array
+ * Store composite d in clean arrays data and hash
  * - mask = size of data - 1
  * - d->hash is the hash code of d
  * data must not contain any deleted eterms and must have at least one empty slot
  */
-static void congruence_table_clean_copy(composite_t **data, composite_t *d, uint32_t mask) {
+static void congruence_table_clean_copy(composite_t **data, uint32_t *hash, composite_t *d, uint32_t mask) {
   uint32_t j;
 
   j = d->hash & mask;
@@ -1240,6 +1243,7 @@ static void congruence_table_clean_copy(composite_t **data, composite_t *d, uint
     j &= mask;
   }
   data[j] = d;
+  hash[j] = d->hash;
 }
 
 
@@ -1256,10 +1260,12 @@ static inline bool live_ptr(composite_t *d) {
  */
 static void congruence_table_cleanup(congruence_table_t *tbl) {
   composite_t **tmp, *d;
+  uint32_t *htmp;
   uint32_t j, n, mask;
 
   n = tbl->size;
   tmp = (composite_t **) safe_malloc(n * sizeof(composite_t *));
+  htmp = (uint32_t *) safe_malloc(n * sizeof(uint32_t));
   for (j=0; j<n; j++) {
     tmp[j] = NULL_COMPOSITE;
   }
@@ -1268,12 +1274,14 @@ static void congruence_table_cleanup(congruence_table_t *tbl) {
   for (j=0; j<n; j++) {
     d = tbl->data[j];
     if (live_ptr(d)) {
-      congruence_table_clean_copy(tmp, d, mask);
+      congruence_table_clean_copy(tmp, htmp, d, mask);
     }
   }
 
   safe_free(tbl->data);
+  safe_free(tbl->hash);
   tbl->data = tmp;
+  tbl->hash = htmp;
   tbl->ndeleted = 0;
 }
 
@@ -1283,6 +1291,7 @@ static void congruence_table_cleanup(congruence_table_t *tbl) {
  */
 static void congruence_table_extend(congruence_table_t *tbl) {
   composite_t **tmp;
+  uint32_t *htmp;
   uint32_t n, n2, j, mask;
   composite_t *d;
 
@@ -1293,6 +1302,7 @@ static void congruence_table_extend(congruence_table_t *tbl) {
   }
 
   tmp = (composite_t **) safe_malloc(n2 * sizeof(composite_t *));
+  htmp = (uint32_t *) safe_malloc(n2 * sizeof(uint32_t));
   for (j=0; j<n2; j++) {
     tmp[j] = NULL_COMPOSITE;
   }
@@ -1301,12 +1311,14 @@ static void congruence_table_extend(congruence_table_t *tbl) {
   for (j=0; j<n; j++) {
     d = tbl->data[j];
     if (live_ptr(d)) {
-      congruence_table_clean_copy(tmp, d, mask);
+      congruence_table_clean_copy(tmp, htmp, d, mask);
     }
   }
 
   safe_free(tbl->data);
+  safe_free(tbl->hash);
   tbl->data = tmp;
+  tbl->hash = htmp;
   tbl->ndeleted = 0;
   tbl->size = n2;
 
@@ -1397,6 +1409,7 @@ void congruence_table_add(congruence_table_t *tbl, composite_t *c) {
   }
 
   tbl->data[j] = c;
+  tbl->hash[j] = c->hash;
   tbl->nelems ++;
   if (tbl->nelems + tbl->ndeleted > tbl->resize_threshold) {
     congruence_table_extend(tbl);
@@ -1419,7 +1432,7 @@ composite_t  *congruence_table_find(congruence_table_t *tbl, signature_t *s, ela
   for (;;) {
     c = tbl->data[j];
     if (c == NULL_COMPOSITE ||
-        (c != DELETED_COMPOSITE && c->hash == h && signature_matches(c, s, &tbl->buffer, label))) {
+        (tbl->hash[j] == h && c != DELETED_COMPOSITE && signature_matches(c, s, &tbl->buffer, label))) {
       return c;
     }
     j ++;
@@ -1466,8 +1479,8 @@ composite_t *congruence_table_find_eq(congruence_table_t *tbl, occ_t t1, occ_t t
   for (;;) {
     c = tbl->data[j];
     if (c == NULL_COMPOSITE ||
-        (c != DELETED_COMPOSITE &&
-         c->tag == mk_eq_tag() && c->hash == h && matches_sigma_eq(c, s, label))) {
+        (tbl->hash[j] == h && c != DELETED_COMPOSITE &&
+         c->tag == mk_eq_tag() && matches_sigma_eq(c, s, label))) {
       return c;
     }
     j ++;
@@ -1496,7 +1509,7 @@ composite_t  *congruence_table_get(congruence_table_t *tbl, composite_t *c, sign
     aux = tbl->data[j];
     if (aux == NULL_COMPOSITE) goto add;
     if (aux == DELETED_COMPOSITE) break;
-    if (aux->hash == h && signature_matches(aux, s, &tbl->buffer, label)) goto found;
+    if (tbl->hash[j] == h && signature_matches(aux, s, &tbl->buffer, label)) goto found;
     j ++;
     j &= mask;
   }
@@ -1511,12 +1524,13 @@ composite_t  *congruence_table_get(congruence_table_t *tbl, composite_t *c, sign
       tbl->ndeleted --;
       goto add;
     }
-    if (aux != DELETED_COMPOSITE &&
-        aux->hash == h && signature_matches(aux, s, &tbl->buffer, label)) goto found;
+    if (tbl->hash[k] == h && aux != DELETED_COMPOSITE &&
+        signature_matches(aux, s, &tbl->buffer, label)) goto found;
   }
 
  add:
   tbl->data[j] = c;
+  tbl->hash[j] = h;
   tbl->nelems ++;
   if (tbl->nelems + tbl->ndeleted > tbl->resize_threshold) {
     congruence_table_extend(tbl);
@@ -911,6 +911,8 @@ static void init_egraph_stats(egraph_stats_t *s) {
 
   s->final_checks = 0;
   s->interface_eqs = 0;
+  s->th_expl_hits = 0;
+  s->th_expl_misses = 0;
 }
 
 /*
@@ -3460,6 +3462,149 @@ static void create_distinct_lemma(egraph_t *egraph, composite_t *d) {
 }
 
 
+/*
+ * DYNAMIC ACKERMANN SCORES
+ *
+ * A candidate pair (t1, t2) gets one hit every time the egraph detects
+ * a conflict while processing (t1 == t2) by congruence. The lemma for
+ * (t1, t2) is generated when its number of hits reaches the Ackermann or
+ * boolean Ackermann threshold and the global budget is not exhausted.
+ *
+ * If ack_decay_period is zero (the default), the hits are counted in the
+ * flag of the pair's cache element and they never decay. Otherwise, they
+ * are stored in ack_scores and they decay: they are halved for every epoch
+ * elapsed since their last update.
+ *
+ * If ack_budget_period is zero (the default), there's no global budget.
+ */
+#define ACK_EPOCH_MASK ((uint32_t) 0xFFFF)
+
+static inline uint32_t ack_score_hits(int32_t val) {
+  return ((uint32_t) val) >> 16;
+}
+
+static inline uint32_t ack_score_epoch(int32_t val) {
+  return ((uint32_t) val) & ACK_EPOCH_MASK;
+}
+
+/*
+ * Number of hits in val after decay
+ */
+static uint32_t ack_score_decayed_hits(egraph_t *egraph, int32_t val) {
+  uint32_t delta;
+
+  delta = (egraph->ack_epoch - ack_score_epoch(val)) & ACK_EPOCH_MASK;
+  if (delta >= 16) {
+    return 0;
+  }
+  return ack_score_hits(val) >> delta;
+}
+
+/*
+ * Add a hit to the pair (t1, t2) and return its new score
+ */
+static uint32_t egraph_bump_ack_score(egraph_t *egraph, eterm_t t1, eterm_t t2) {
+  int_hmap2_rec_t *r;
+  uint32_t hits;
+  eterm_t aux;
+  bool new;
+
+  if (t1 > t2) {
+    aux = t1; t1 = t2; t2 = aux;
+  }
+
+  r = int_hmap2_get(&egraph->ack_scores, t1, t2, &new);
+  hits = 0;
+  if (!new) {
+    hits = ack_score_decayed_hits(egraph, r->val);
+  }
+  if (hits < UINT16_MAX) {
+    hits ++;
+  }
+  r->val = (int32_t) ((hits << 16) | (egraph->ack_epoch & ACK_EPOCH_MASK));
+
+  return hits;
+}
+
+/*
+ * Keep-alive functions for garbage collection in ack_scores:
+ * - ack_score_is_hot: remove pairs whose score has decayed to zero
+ * - ack_score_is_live: remove pairs that contain a deleted term
+ *   (i.e., a term of index >= egraph->terms.nterms).
+ */
+static bool ack_score_is_hot(egraph_t *egraph, int_hmap2_rec_t *r) {
+  return ack_score_decayed_hits(egraph, r->val) > 0;
+}
+
+static bool ack_score_is_live(egraph_t *egraph, int_hmap2_rec_t *r) {
+  assert(r->k0 < r->k1);
+  return r->k1 < egraph->terms.nterms;
+}
+
+/*
+ * Start a new epoch if enough conflicts have occurred since the last one
+ */
+static void egraph_update_ack_epoch(egraph_t *egraph) {
+  uint64_t c;
+
+  if (egraph->ack_decay_period == 0) {
+    return;
+  }
+
+  c = num_conflicts(egraph->core);
+  if (c >= egraph->ack_next_epoch) {
+    egraph->ack_epoch ++;
+    egraph->ack_next_epoch = c + egraph->ack_decay_period;
+    int_hmap2_gc(&egraph->ack_scores, egraph, (keep_alive_fun_t) ack_score_is_hot);
+  }
+}
+
+/*
+ * Check whether the global budget on Ackermann lemmas is exhausted
+ */
+static bool egraph_ack_budget_exhausted(egraph_t *egraph) {
+  uint64_t budget;
+
+  if (egraph->ack_budget_period == 0) {
+    return false;
+  }
+
+  budget = egraph->ack_budget + num_conflicts(egraph->core)/egraph->ack_budget_period;
+  return egraph->stats.ack_lemmas + egraph->stats.boolack_lemmas >= budget;
+}
+
+/*
+ * Record a hit for the pair (t1, t2) and check whether the lemma
+ * for this pair must be generated now.
+ * - e = cache element for (t1, t2)
+ * - threshold = Ackermann or boolean Ackermann threshold
+ * - once the lemma is generated, e->flag is set to threshold
+ */
+static bool egraph_ack_hit(egraph_t *egraph, cache_elem_t *e, eterm_t t1, eterm_t t2, uint16_t threshold) {
+  uint32_t hits;
+
+  if (e->flag >= threshold) {
+    return false; // already generated
+  }
+
+  if (egraph->ack_decay_period == 0) {
+    hits = e->flag + 1;
+    if (hits < threshold) {
+      e->flag = hits;
+    }
+  } else {
+    hits = egraph_bump_ack_score(egraph, t1, t2);
+  }
+
+  if (hits < threshold || egraph_ack_budget_exhausted(egraph)) {
+    return false;
+  }
+
+  e->flag = threshold;
+  return true;
+}
+
+
 /*
  * Get cache element for ackermann lemma (t1, t2)
  */
@@ -3506,40 +3651,37 @@ static void create_ackermann_lemma(egraph_t *egraph, composite_t *c1, composite_
        *  (eq t_1 u_1) AND ... AND (eq t_n u_n) AND x1 ==> x2
        *  (eq t_1 u_1) AND ... AND (eq t_n u_n) AND x2 ==> x1
        *
-       * Before generating the clauses, check the number of hits for
-       * the pair (b1, b2). Add the clauses if this reaches
+       * Before generating the clauses, check the number of hits
+       * for the pair (b1, b2). Add the clauses if this reaches
        * boolack_threshold.
        */
       e = cache_get_ackermann_lemma(&egraph->cache, b1, b2);
-      if (e->flag < egraph->boolack_threshold) {
-        e->flag ++;
-        if (e->flag == egraph->boolack_threshold) {
-          x1 = egraph_term_base_thvar(egraph, b1);
-          x2 = egraph_term_base_thvar(egraph, b2);
-          if (x1 != null_thvar && x2 != null_thvar) {
-            // generate the clause
-            v = &egraph->aux_buffer;
-            ivector_reset(v);
-            n = composite_arity(c1);
-            for (i=0; i<n; i++) {
-              l = egraph_make_aux_eq(egraph, c1->child[i], c2->child[i]);
-              if (l == null_literal) return; // quota exceeded: fail
-              if (l != true_literal) {
-                ivector_push(v, not(l));
-              }
+      if (egraph_ack_hit(egraph, e, b1, b2, egraph->boolack_threshold)) {
+        x1 = egraph_term_base_thvar(egraph, b1);
+        x2 = egraph_term_base_thvar(egraph, b2);
+        if (x1 != null_thvar && x2 != null_thvar) {
+          // generate the clause
+          v = &egraph->aux_buffer;
+          ivector_reset(v);
+          n = composite_arity(c1);
+          for (i=0; i<n; i++) {
+            l = egraph_make_aux_eq(egraph, c1->child[i], c2->child[i]);
+            if (l == null_literal) return; // quota exceeded: fail
+            if (l != true_literal) {
+              ivector_push(v, not(l));
             }
-            i = v->size;
-            // add x1 ==> x2
-            ivector_push(v, neg_lit(x1));
-            ivector_push(v, pos_lit(x2));
-            add_clause(egraph->core, v->size, v->data);
-            // add x2 ==> x1
-            v->data[i] = neg_lit(x2);
-            v->data[i+1] = pos_lit(x1);
-            add_clause(egraph->core, v->size, v->data);
-
-            egraph->stats.boolack_lemmas ++;
           }
+          i = v->size;
+          // add x1 ==> x2
+          ivector_push(v, neg_lit(x1));
+          ivector_push(v, pos_lit(x2));
+          add_clause(egraph->core, v->size, v->data);
+          // add x2 ==> x1
+          v->data[i] = neg_lit(x2);
+          v->data[i+1] = pos_lit(x1);
+          add_clause(egraph->core, v->size, v->data);
+
+          egraph->stats.boolack_lemmas ++;
         }
       }
     }
@@ -3558,49 +3700,46 @@ static void create_ackermann_lemma(egraph_t *egraph, composite_t *c1, composite_
        * reaches ackermann_threshold.
        */
       e = cache_get_ackermann_lemma(&egraph->cache, b1, b2);
-      if (e->flag < egraph->ackermann_threshold) {
-        e->flag ++;
-        if (e->flag == egraph->ackermann_threshold) {
-          v = &egraph->aux_buffer;
-          ivector_reset(v);
-          n = composite_arity(c1);
-          for (i=0; i<n; i++) {
-            l = egraph_make_aux_eq(egraph, c1->child[i], c2->child[i]);
-            if (l == null_literal) return; // aux_eq_quota exceeded
-            if (l != true_literal) {
-              ivector_push(v, not(l));
-            }
+      if (egraph_ack_hit(egraph, e, b1, b2, egraph->ackermann_threshold)) {
+        v = &egraph->aux_buffer;
+        ivector_reset(v);
+        n = composite_arity(c1);
+        for (i=0; i<n; i++) {
+          l = egraph_make_aux_eq(egraph, c1->child[i], c2->child[i]);
+          if (l == null_literal) return; // aux_eq_quota exceeded
+          if (l != true_literal) {
+            ivector_push(v, not(l));
           }
-          l = egraph_make_eq(egraph, pos_occ(b1), pos_occ(b2));
-          ivector_push(v, l);
+        }
+        l = egraph_make_eq(egraph, pos_occ(b1), pos_occ(b2));
+        ivector_push(v, l);
 
 #if 0
-          printf("---> ackermann lemma[%"PRIu32"]:\n", egraph->stats.ack_lemmas + 1);
-          n = v->size;
-          assert(n > 0);
-          if (n > 1) {
-            printf("(or ");
-          }
-          for (i=0; i<n; i++) {
-            printf(" ");
-            print_egraph_atom_of_literal(stdout, egraph, v->data[i]);
-          }
-          if (n > 1) {
-            printf(")");
-          }
-          printf("\n");
-          printf("      ");
-          print_eterm_def(stdout, egraph,  c1->id);
-          printf("      ");
-          print_eterm_def(stdout, egraph,  c2->id);
-          fflush(stdout);
+        printf("---> ackermann lemma[%"PRIu32"]:\n", egraph->stats.ack_lemmas + 1);
+        n = v->size;
+        assert(n > 0);
+        if (n > 1) {
+          printf("(or ");
+        }
+        for (i=0; i<n; i++) {
+          printf(" ");
+          print_egraph_atom_of_literal(stdout, egraph, v->data[i]);
+        }
+        if (n > 1) {
+          printf(")");
+        }
+        printf("\n");
+        printf("      ");
+        print_eterm_def(stdout, egraph,  c1->id);
+        printf("      ");
+        print_eterm_def(stdout, egraph,  c2->id);
+        fflush(stdout);
 #endif
 
-          add_clause(egraph->core, v->size, v->data);
+        add_clause(egraph->core, v->size, v->data);
 
-          // update statistics
-          egraph->stats.ack_lemmas ++;
-        }
+        // update statistics
+        egraph->stats.ack_lemmas ++;
       }
     }
   }
@@ -4596,6 +4735,7 @@ void egraph_reset(egraph_t *egraph) {
   reset_class_table(&egraph->classes);
   reset_eterm_table(&egraph->terms);
   reset_egraph_stack(&egraph->stack);
+  egraph_expl_cache_reset(egraph);
   reset_undo_stack(&egraph->undo);
   reset_distinct_table(&egraph->dtable);
   reset_congruence_table(&egraph->ctable);
@@ -4606,6 +4746,9 @@ void egraph_reset(egraph_t *egraph) {
   reset_int_htbl(&egraph->htbl);
   reset_objstore(&egraph->atom_store);  // delete all atoms
   reset_cache(&egraph->cache);
+  reset_int_hmap2(&egraph->ack_scores);
+  egraph->ack_epoch = 0;
+  egraph->ack_next_epoch = egraph->ack_decay_period;
   arena_reset(&egraph->arena);
   reset_istack(&egraph->istack);
 
@@ -4865,6 +5008,7 @@ static void egraph_local_backtrack(egraph_t *egraph, uint32_t back_level) {
   if (egraph->ack_left != null_occurrence &&
       egraph_option_enabled(egraph, EGRAPH_DYNAMIC_ACKERMANN | EGRAPH_DYNAMIC_BOOLACKERMANN)) {
     assert(egraph->ack_right != null_occurrence);
+    egraph_update_ack_epoch(egraph);
     egraph_gen_ackermann_lemma(egraph, egraph->ack_left, egraph->ack_right);
     egraph->ack_left = null_occurrence;
     egraph->ack_right = null_occurrence;
@@ -4908,9 +5052,10 @@ static void egraph_local_backtrack(egraph_t *egraph, uint32_t back_level) {
   assert(i == k);
   egraph->undo.top = k;
 
-  // Cleanup the propagation stack
+  // Cleanup the propagation stack and the explanation cache
   k = egraph->stack.level_index[back_level + 1];
   egraph->stack.top = k;
+  egraph_expl_cache_backtrack(egraph, back_level);
   egraph->stack.prop_ptr = k;
 
   // delete all temporary data in the arena
@@ -5104,8 +5249,9 @@ void egraph_pop(egraph_t *egraph) {
   // restore the propagation pointer
   egraph->stack.prop_ptr = trail->prop_ptr;
 
-  // cleanup the cache
+  // cleanup the cache and remove scores of deleted terms
   cache_pop(&egraph->cache);
+  int_hmap2_gc(&egraph->ack_scores, egraph, (keep_alive_fun_t) ack_score_is_live);
 
   // remove top trail element
   egraph_trail_pop(&egraph->trail_stack);
@@ -5961,18 +6107,13 @@ static void egraph_reconciliation_restore(egraph_t *egraph) {
  ****************/
 
 /*
- * BASELINE VERSION OF FINAL CHECK
- * - call final_check on all satellites then use the reconcile_model
- *   function in each solver
+ * Final check for the arithmetic and bitvector solvers
+ * - these don't create terms or read the global type table so they
+ *   can run without holding the global lock
+ * - return FCHECK_SAT if both solvers are happy
  */
-static fcheck_code_t baseline_final_check(egraph_t *egraph) {
+static fcheck_code_t satellites_final_check(egraph_t *egraph) {
   fcheck_code_t c;
-  uint32_t i, max_eq;
-
-#if TRACE_FCHECK
-  printf("---> EGRAPH: final check (baseline)\n");
-  fflush(stdout);
-#endif
 
   if (egraph->ctrl[ETYPE_REAL] != NULL) {
     // arithmetic solver
@@ -5991,13 +6132,32 @@ static fcheck_code_t baseline_final_check(egraph_t *egraph) {
     c = egraph->ctrl[ETYPE_BV]->final_check(egraph->th[ETYPE_BV]);
     if (c != FCHECK_SAT) {
 #if TRACE_FCHECK
-       printf("---> exit at bv final check\n");
-       fflush(stdout);
+      printf("---> exit at bv final check\n");
+      fflush(stdout);
 #endif
       return c;
     }
   }
 
+  return FCHECK_SAT;
+}
+
+
+/*
+ * BASELINE VERSION OF FINAL CHECK
+ * - call final_check on the array solver (arithmetic and bitvector
+ *   solvers are handled by satellites_final_check) then use the
+ *   reconcile_model function in each solver
+ */
+static fcheck_code_t baseline_final_check(egraph_t *egraph) {
+  fcheck_code_t c;
+  uint32_t i, max_eq;
+
+#if TRACE_FCHECK
+  printf("---> EGRAPH: final check (baseline)\n");
+  fflush(stdout);
+#endif
+
   if (egraph->ctrl[ETYPE_FUNCTION] != NULL) {
     // array solver
     c = egraph->ctrl[ETYPE_FUNCTION]->final_check(egraph->th[ETYPE_FUNCTION]);
@@ -6084,30 +6244,6 @@ static fcheck_code_t experimental_final_check(egraph_t *egraph) {
   fflush(stdout);
 #endif
 
-  if (egraph->ctrl[ETYPE_REAL] != NULL) {
-    c = egraph->ctrl[ETYPE_REAL]->final_check(egraph->th[ETYPE_REAL]);
-    if (c != FCHECK_SAT) {
-#if TRACE_FCHECK
-      printf("---> exit at arith final check\n");
-      fflush(stdout);
-#endif
-      return c;
-    }
-  }
-
-  if (egraph->ctrl[ETYPE_BV] != NULL) {
-    // bitvector solver
-    c = egraph->ctrl[ETYPE_BV]->final_check(egraph->th[ETYPE_BV]);
-    if (c != FCHECK_SAT) {
-#if TRACE_FCHECK
-      printf("---> exit at bv final check\n");
-      fflush(stdout);
-#endif
-      return c;
-    }
-  }
-
-
   /*
    * Try egraph reconciliation
    */
@@ -6183,13 +6319,11 @@ static fcheck_code_t experimental_final_check(egraph_t *egraph) {
 
 
 /*
- * Call final check for all the satellite solvers
- * If all return SAT, try to build consistent models
- * If models are not consistent, generate interface equalities
+ * Model reconciliation and array solver: these create new terms
+ * (interface equalities, Skolem constants) and read the global
+ * type table so they must run with the global lock.
  */
-fcheck_code_t _o_egraph_final_check(egraph_t *egraph) {
-  egraph->stats.final_checks ++;
-
+static fcheck_code_t _o_egraph_reconcile_final_check(egraph_t *egraph) {
   if (egraph_option_disabled(egraph, EGRAPH_OPTIMISTIC_FCHECK)) {
     return baseline_final_check(egraph);
   } else {
@@ -6197,8 +6331,29 @@ fcheck_code_t _o_egraph_final_check(egraph_t *egraph) {
   }
 }
 
+static fcheck_code_t egraph_reconcile_final_check(egraph_t *egraph) {
+  MT_PROTECT(fcheck_code_t, __yices_globals.lock, _o_egraph_reconcile_final_check(egraph));
+}
+
+/*
+ * Call final check for all the satellite solvers
+ * If all return SAT, try to build consistent models
+ * If models are not consistent, generate interface equalities
+ *
+ * The global lock is taken only after the arithmetic and bitvector
+ * solvers are both satisfied.
+ */
 fcheck_code_t egraph_final_check(egraph_t *egraph) {
-  MT_PROTECT(fcheck_code_t, __yices_globals.lock, _o_egraph_final_check(egraph));
+  fcheck_code_t c;
+
+  egraph->stats.final_checks ++;
+
+  c = satellites_final_check(egraph);
+  if (c != FCHECK_SAT) {
+    return c;
+  }
+
+  return egraph_reconcile_final_check(egraph);
 }
 
 
@@ -6729,6 +6884,11 @@ void init_egraph(egraph_t *egraph, type_table_t *ttbl) {
   egraph->max_interface_eqs = DEFAULT_MAX_INTERFACE_EQS;
   egraph->ack_left = null_occurrence;
   egraph->ack_right = null_occurrence;
+  egraph->ack_epoch = 0;
+  egraph->ack_decay_period = DEFAULT_ACK_DECAY_PERIOD;
+  egraph->ack_next_epoch = DEFAULT_ACK_DECAY_PERIOD;
+  egraph->ack_budget = DEFAULT_ACK_BUDGET;
+  egraph->ack_budget_period = DEFAULT_ACK_BUDGET_PERIOD;
 
   init_class_table(&egraph->classes, DEFAULT_CLASS_TABLE_SIZE);
   init_eterm_table(&egraph->terms, DEFAULT_ETERM_TABLE_SIZE);
@@ -6748,6 +6908,7 @@ void init_egraph(egraph_t *egraph, type_table_t *ttbl) {
   init_int_htbl(&egraph->htbl, 0);
   init_objstore(&egraph->atom_store, sizeof(atom_t), ATOM_BANK_SIZE);
   init_cache(&egraph->cache);
+  init_int_hmap2(&egraph->ack_scores, 0);
 
   egraph->imap = NULL;
   init_sign_buffer(&egraph->sgn);
@@ -6768,6 +6929,9 @@ void init_egraph(egraph_t *egraph, type_table_t *ttbl) {
 
   init_pvector(&egraph->reanalyze_vector, 0);
   init_th_explanation(&egraph->th_expl);
+  egraph->expl_cache = NULL;
+  egraph->expl_cache_size = 0;
+  init_ivector(&egraph->expl_cache_trail, 0);
   egraph->app_partition = NULL;
 
   // satellite solvers and descriptors
@@ -6882,6 +7046,10 @@ void delete_egraph(egraph_t *egraph) {
     egraph->app_partition = NULL;
   }
   delete_th_explanation(&egraph->th_expl);
+  egraph_expl_cache_reset(egraph);
+  safe_free(egraph->expl_cache);
+  egraph->expl_cache = NULL;
+  delete_ivector(&egraph->expl_cache_trail);
   delete_pvector(&egraph->reanalyze_vector);
   delete_ivector(&egraph->interface_eqs);
   delete_istack(&egraph->istack);
@@ -6897,6 +7065,7 @@ void delete_egraph(egraph_t *egraph) {
     egraph->imap = NULL;
   }
   delete_cache(&egraph->cache);
+  delete_int_hmap2(&egraph->ack_scores);
   delete_objstore(&egraph->atom_store);
   delete_int_htbl(&egraph->htbl);
   egraph_free_const_htbl(egraph);
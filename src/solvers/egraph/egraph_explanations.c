@@ -838,13 +838,146 @@ static inline etype_t etag2theory(expl_tag_t id) {
 }
 
 
+/*
+ * CACHE OF THEORY EXPLANATIONS
+ */
+
+/*
+ * Expanding the explanation of an edge propagated by a satellite
+ * solver can be expensive (e.g., the simplex solver must walk its
+ * bound stack). The same edge is often expanded in many conflicts
+ * so we keep the satellite's explanation for edge i in expl_cache[i].
+ *
+ * The explanation is built from literals and equalities that are
+ * true at the decision level where it was constructed. It remains
+ * valid until the egraph backtracks below that level. The cache is
+ * not used in reconcile mode, since edges created during
+ * reconciliation are removed without backtracking.
+ *
+ * The cache is used only if option EGRAPH_CACHE_EXPLANATIONS is
+ * enabled. Entries are removed on backtracking whether or not the
+ * option is set, so toggling it between checks is safe.
+ */
+
+/*
+ * Make sure expl_cache has size >= egraph->stack.size
+ */
+static void resize_expl_cache(egraph_t *egraph) {
+  uint32_t i, n;
+
+  n = egraph->stack.size;
+  if (egraph->expl_cache_size < n) {
+    egraph->expl_cache = (th_explanation_t **) safe_realloc(egraph->expl_cache, n * sizeof(th_explanation_t *));
+    for (i=egraph->expl_cache_size; i<n; i++) {
+      egraph->expl_cache[i] = NULL;
+    }
+    egraph->expl_cache_size = n;
+  }
+}
+
+/*
+ * Free the cached explanation for edge i if any
+ */
+static void free_cached_explanation(egraph_t *egraph, int32_t i) {
+  th_explanation_t *e;
+
+  assert(0 <= i && (uint32_t) i < egraph->expl_cache_size);
+  e = egraph->expl_cache[i];
+  if (e != NULL) {
+    delete_th_explanation(e);
+    safe_free(e);
+    egraph->expl_cache[i] = NULL;
+  }
+}
+
+/*
+ * Store a copy of e as the cached explanation for edge i
+ */
+static void cache_th_explanation(egraph_t *egraph, int32_t i, th_explanation_t *e) {
+  th_explanation_t *copy;
+  uint32_t j, n;
+
+  resize_expl_cache(egraph);
+  assert(0 <= i && (uint32_t) i < egraph->expl_cache_size && egraph->expl_cache[i] == NULL);
+
+  copy = (th_explanation_t *) safe_malloc(sizeof(th_explanation_t));
+  init_th_explanation(copy);
+  if (e->atoms != NULL) {
+    n = get_av_size(e->atoms);
+    for (j=0; j<n; j++) {
+      th_explanation_add_atom(copy, e->atoms[j]);
+    }
+  }
+  if (e->eqs != NULL) {
+    n = get_eqv_size(e->eqs);
+    for (j=0; j<n; j++) {
+      th_explanation_add_eq(copy, e->eqs[j].lhs, e->eqs[j].rhs);
+    }
+  }
+  if (e->diseqs != NULL) {
+    n = get_diseqv_size(e->diseqs);
+    for (j=0; j<n; j++) {
+      th_explanation_add_diseq(copy, e->diseqs + j);
+    }
+  }
+
+  egraph->expl_cache[i] = copy;
+  ivector_push(&egraph->expl_cache_trail, i);
+  ivector_push(&egraph->expl_cache_trail, egraph->decision_level);
+}
+
+/*
+ * Get the cached explanation for edge i (NULL if there's none)
+ */
+static th_explanation_t *cached_th_explanation(egraph_t *egraph, int32_t i) {
+  assert(i >= 0);
+  return (uint32_t) i < egraph->expl_cache_size ? egraph->expl_cache[i] : NULL;
+}
+
+
+/*
+ * Remove all cache entries created at a level > back_level
+ */
+void egraph_expl_cache_backtrack(egraph_t *egraph, uint32_t back_level) {
+  ivector_t *trail;
+  uint32_t n;
+
+  trail = &egraph->expl_cache_trail;
+  n = trail->size;
+  while (n > 0 && (uint32_t) trail->data[n-1] > back_level) {
+    free_cached_explanation(egraph, trail->data[n-2]);
+    n -= 2;
+  }
+  ivector_shrink(trail, n);
+}
+
+
+/*
+ * Remove all cache entries
+ */
+void egraph_expl_cache_reset(egraph_t *egraph) {
+  ivector_t *trail;
+  uint32_t n;
+
+  trail = &egraph->expl_cache_trail;
+  n = trail->size;
+  while (n > 0) {
+    free_cached_explanation(egraph, trail->data[n-2]);
+    n -= 2;
+  }
+  ivector_reset(trail);
+}
+
+
+
 /*
  * Explanation for equality (t1 == t2) propagated from a theory solver
  * - id = one of EXPL_ARITH_PROPAGATION, EXPL_BV_PROPAGATION, EXPL_FUN_PROPAGATION
+ * - k = the edge for (t1 == t2)
  * - expl = whatever the solver gave as explanation when it called egraph_propagate_equality
  * - v = vector of literals (partial explanation under construction)
  */
-static void explain_theory_equality(egraph_t *egraph, expl_tag_t id, eterm_t t1, eterm_t t2,
+static void explain_theory_equality(egraph_t *egraph, expl_tag_t id, int32_t k, eterm_t t1, eterm_t t2,
                                     void *expl, ivector_t *v) {
   th_explanation_t *e;
   etype_t tau;
@@ -855,17 +988,33 @@ static void explain_theory_equality(egraph_t *egraph, expl_tag_t id, eterm_t t1,
   diseq_pre_expl_t *diseqs;
   composite_t *cmp;
   occ_t t;
+  bool use_cache;
+
+  e = NULL;
+  use_cache = egraph_option_enabled(egraph, EGRAPH_CACHE_EXPLANATIONS) && !egraph->reconcile_mode;
+  if (use_cache) {
+    e = cached_th_explanation(egraph, k);
+  }
 
-  e = &egraph->th_expl;
-  tau = etag2theory(id);
-  x1 = egraph_term_base_thvar(egraph, t1);
-  x2 = egraph_term_base_thvar(egraph, t2);
+  if (e != NULL) {
+    egraph->stats.th_expl_hits ++;
+  } else {
+    e = &egraph->th_expl;
+    tau = etag2theory(id);
+    x1 = egraph_term_base_thvar(egraph, t1);
+    x2 = egraph_term_base_thvar(egraph, t2);
 
-  assert(x1 != null_thvar && x2 != null_thvar);
+    assert(x1 != null_thvar && x2 != null_thvar);
 
-  // get explanation from the satellite solver
-  reset_th_explanation(e);
-  egraph->eg[tau]->expand_th_explanation(egraph->th[tau], x1, x2, expl, e);
+    // get explanation from the satellite solver
+    reset_th_explanation(e);
+    egraph->eg[tau]->expand_th_explanation(egraph->th[tau], x1, x2, expl, e);
+    egraph->stats.th_expl_misses ++;
+
+    if (use_cache) {
+      cache_th_explanation(egraph, k, e);
+    }
+  }
 
   /*
    * e->atoms = list of literals (attached to theory specific atoms)
@@ -1053,7 +1202,7 @@ static void build_explanation_vector(egraph_t *egraph, ivector_t *v) {
     case EXPL_FUN_PROPAGATION:
       t1 = term_of_occ(eq[i].lhs);
       t2 = term_of_occ(eq[i].rhs);
-      explain_theory_equality(egraph, etag[i], t1, t2, edata[i].ptr, v);
+      explain_theory_equality(egraph, etag[i], i, t1, t2, edata[i].ptr, v);
       break;
 
     case EXPL_RECONCILE:
@@ -181,6 +181,23 @@ extern bool egraph_inconsistent_not_distinct(egraph_t *egraph, composite_t *d, i
 
 
 
+/*
+ * CACHE OF THEORY EXPLANATIONS
+ */
+
+/*
+ * Remove all cached explanations created at a decision level > back_level
+ * - this must be called when the egraph backtracks to back_level
+ */
+extern void egraph_expl_cache_backtrack(egraph_t *egraph, uint32_t back_level);
+
+/*
+ * Remove all cached explanations
+ */
+extern void egraph_expl_cache_reset(egraph_t *egraph);
+
+
+
 /*
  * SUPPORT FOR EGRAPH/THEORY SOLVER RECONCILIATION
  */
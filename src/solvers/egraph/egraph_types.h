@@ -251,6 +251,7 @@
 #include "utils/arena.h"
 #include "utils/cache.h"
 #include "utils/int_hash_map.h"
+#include "utils/int_hash_map2.h"
 #include "utils/int_hash_tables.h"
 #include "utils/int_partitions.h"
 #include "utils/int_stack.h"
@@ -682,9 +683,16 @@ typedef struct signature_s {
 /*
  * Hash-table of composites: stores a unique representative
  * (congruence root) per signature. It's similar to int_hash_table.
+ *
+ * The signature hash of each composite is stored in a parallel
+ * array: hash[i] = data[i]->hash if data[i] is a live composite.
+ * Probes compare hash codes first and dereference data[i] only if
+ * the hash codes match. The hash array is meaningless for empty
+ * and deleted slots.
  */
 typedef struct congruence_table_s {
   composite_t **data;  // the hash table proper
+  uint32_t *hash;      // hash codes of the composites in data
   uint32_t size;       // its size (must be a power of 2)
   uint32_t nelems;     // number of elements
   uint32_t ndeleted;   // deleted elements
@@ -1273,6 +1281,10 @@ typedef struct egraph_stats_s {
   uint32_t final_checks;     // number of calls to final check
   uint32_t interface_eqs;    // number of interface equalities generated
 
+  // theory explanations
+  uint32_t th_expl_hits;     // number of theory explanations found in the cache
+  uint32_t th_expl_misses;   // number of theory explanations built by a satellite solver
+
 } egraph_stats_t;
 
 
@@ -1360,6 +1372,33 @@ struct egraph_s {
    */
   occ_t ack_left, ack_right;
 
+  /*
+   * Dynamic Ackermann scores (used if ack_decay_period is positive):
+   * - ack_scores maps a candidate pair (t1, t2) with t1 < t2 to a score
+   *   that counts how often (t1 == t2) was involved in a conflict.
+   *   The score is packed with the epoch of its last update:
+   *   val = (hits << 16) | (epoch & 0xFFFF).
+   * - a new epoch starts every ack_decay_period conflicts. A score is
+   *   halved for each epoch elapsed since its last update so that only
+   *   pairs that keep showing up in conflicts reach the thresholds.
+   *   Cold pairs (whose score has decayed to zero) are removed from
+   *   ack_scores when an epoch ends.
+   * - ack_next_epoch = number of conflicts at which the next epoch starts
+   *
+   * Global budget (used if ack_budget_period is positive): the total
+   * number of Ackermann lemmas (boolean and non-boolean) is bounded by
+   * ack_budget + (number of conflicts)/ack_budget_period, so lemma
+   * generation keeps pace with the search.
+   *
+   * Both are disabled by default.
+   */
+  int_hmap2_t ack_scores;
+  uint32_t ack_epoch;
+  uint32_t ack_decay_period;
+  uint64_t ack_next_epoch;
+  uint32_t ack_budget;
+  uint32_t ack_budget_period;
+
   /*
    * Limit on the number of interface equalities created
    * in each call to final_check
@@ -1438,6 +1477,20 @@ struct egraph_s {
    */
   th_explanation_t th_expl;
 
+  /*
+   * Cache of theory explanations (cf. egraph_explanations.c)
+   * - expl_cache[i] = explanation built by a satellite solver for edge i,
+   *   or NULL. This array is allocated on demand and extended to match
+   *   the size of the propagation stack. Its size is expl_cache_size.
+   * - expl_cache_trail = pairs <edge, decision level> in the order
+   *   cache entries were created (so levels are non-decreasing).
+   *   Entries created at a level larger than back_level are removed
+   *   when the egraph backtracks.
+   */
+  th_explanation_t **expl_cache;
+  uint32_t expl_cache_size;
+  ivector_t expl_cache_trail;
+
   /*
    * Helper for the array theory solver
    * allocated on demand
@@ -1496,15 +1549,23 @@ struct egraph_s {
  * OPTIMISTIC_FCHECK selects the experimental version of final_check instead of the
  * baseline version.
  *
+ * CACHE_EXPLANATIONS enables the cache of theory explanations (see expl_cache).
+ * It's disabled by default.
+ *
  * In addition, aux_eq_quota is a bound on the total number of new equalities allowed
  * for ackermann lemmas.
  *
+ * Optionally, both kinds of lemmas can also be subject to a global budget that
+ * grows with the number of conflicts (see ack_budget and ack_budget_period), and
+ * candidate pairs can be selected by a decaying score (see ack_scores).
+ *
  * MAX_INTERFACE_EQS is a bound on the number of interface equalities created
  * in each call to final_check.
  */
 #define EGRAPH_DYNAMIC_ACKERMANN       0x1
 #define EGRAPH_DYNAMIC_BOOLACKERMANN   0x2
 #define EGRAPH_OPTIMISTIC_FCHECK       0x4
+#define EGRAPH_CACHE_EXPLANATIONS      0x8
 #define EGRAPH_DISABLE_ALL_OPTIONS     0x0
 
 #define DEFAULT_MAX_ACKERMANN         1000
@@ -1514,6 +1575,10 @@ struct egraph_s {
 #define DEFAULT_ACKERMANN_THRESHOLD   8
 #define DEFAULT_BOOLACK_THRESHOLD     8
 
+#define DEFAULT_ACK_DECAY_PERIOD      0
+#define DEFAULT_ACK_BUDGET            100
+#define DEFAULT_ACK_BUDGET_PERIOD     0
+
 #define DEFAULT_MAX_INTERFACE_EQS     200
 
 
@@ -545,6 +545,38 @@ static inline uint16_t egraph_get_boolack_threshold(egraph_t *egraph) {
 }
 
 
+/*
+ * Global budget on Ackermann lemmas (boolean and non-boolean):
+ * - at most n + c/period lemmas are generated after c conflicts
+ * - period = 0 means no budget
+ */
+static inline void egraph_set_ackermann_budget(egraph_t *egraph, uint32_t n, uint32_t period) {
+  egraph->ack_budget = n;
+  egraph->ack_budget_period = period;
+}
+
+static inline uint32_t egraph_get_ackermann_budget(egraph_t *egraph) {
+  return egraph->ack_budget;
+}
+
+static inline uint32_t egraph_get_ackermann_budget_period(egraph_t *egraph) {
+  return egraph->ack_budget_period;
+}
+
+
+/*
+ * Set/get the decay period for Ackermann scores: scores are
+ * halved every n conflicts (n = 0 means no decay).
+ */
+static inline void egraph_set_ackermann_decay_period(egraph_t *egraph, uint32_t n) {
+  egraph->ack_decay_period = n;
+}
+
+static inline uint32_t egraph_get_ackermann_decay_period(egraph_t *egraph) {
+  return egraph->ack_decay_period;
+}
+
+
 /*
  * Set a quota: maximal number of new equalities created
  */
@@ -584,6 +616,14 @@ static inline void egraph_disable_optimistic_final_check(egraph_t *egraph) {
   egraph_disable_options(egraph, EGRAPH_OPTIMISTIC_FCHECK);
 }
 
+static inline void egraph_enable_explanation_cache(egraph_t *egraph) {
+  egraph_enable_options(egraph, EGRAPH_CACHE_EXPLANATIONS);
+}
+
+static inline void egraph_disable_explanation_cache(egraph_t *egraph) {
+  egraph_disable_options(egraph, EGRAPH_CACHE_EXPLANATIONS);
+}
+
 
 
 
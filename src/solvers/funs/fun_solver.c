@@ -500,7 +500,7 @@ static void delete_fun_trail_stack(fun_trail_stack_t *stack) {
  * - nv = number of variables
  * - ne = number of edges
  */
-static void fun_trail_stack_save(fun_trail_stack_t *stack, uint32_t nv, uint32_t ne) {
+static void fun_trail_stack_save(fun_trail_stack_t *stack, uint32_t nv, uint32_t ne, uint32_t nw) {
   uint32_t i;
 
   i = stack->top;
@@ -510,6 +510,7 @@ static void fun_trail_stack_save(fun_trail_stack_t *stack, uint32_t nv, uint32_t
   assert(i < stack->size);
   stack->data[i].nvars = nv;
   stack->data[i].nedges = ne;
+  stack->data[i].nwitnesses = nw;
   stack->top = i + 1;
 }
 
@@ -1038,18 +1039,33 @@ static inline type_t fun_var_range_type(fun_solver_t *solver, thvar_t x) {
 }
 
 /*
- * Create the extensionality axiom for (x != y)
- * - x and y must have the same domain
+ * Witness literal for x and y: (= (x i_1 ... i_n) (y i_1 ... i_n))
+ * - i_1 ... i_n are fresh Skolem constants, created on the first call
+ *   for the pair {x, y}
+ * - the literal is stored in solver->witness and returned by all
+ *   subsequent calls for the same pair
  */
-static void fun_solver_extensionality_axiom(fun_solver_t *solver, thvar_t x, thvar_t y) {
+static literal_t fun_solver_witness(fun_solver_t *solver, thvar_t x, thvar_t y) {
   fun_vartable_t *vtbl;
   egraph_t *egraph;
   ivector_t *v;
+  int_hmap2_rec_t *r;
   eterm_t t, u;
-  literal_t l1, l2;
+  thvar_t aux;
+  literal_t l;
 
   assert(0 <= x && x < solver->vtbl.nvars && 0 <= y && y < solver->vtbl.nvars && x != y);
 
+  if (x > y) {
+    aux = x; x = y; y = aux;
+  }
+
+  r = int_hmap2_find(&solver->witness_map, x, y);
+  if (r != NULL) {
+    assert(0 <= r->val && (uint32_t) r->val < solver->witness.size);
+    return solver->witness.data[r->val];
+  }
+
   egraph = solver->egraph;
   vtbl = &solver->vtbl;
   v = &solver->aux_vector;
@@ -1058,7 +1074,37 @@ static void fun_solver_extensionality_axiom(fun_solver_t *solver, thvar_t x, thv
 
   t = egraph_make_apply(egraph, pos_occ(vtbl->eterm[x]), v->size, v->data, fun_var_range_type(solver, x));
   u = egraph_make_apply(egraph, pos_occ(vtbl->eterm[y]), v->size, v->data, fun_var_range_type(solver, y));
-  l1 = egraph_make_eq(egraph, pos_occ(t), pos_occ(u));
+  l = egraph_make_eq(egraph, pos_occ(t), pos_occ(u));
+
+  ivector_reset(v);
+
+#if TRACE
+  printf("New witness for f!%"PRId32" and f!%"PRId32":\n", x, y);
+  print_eterm_def(stdout, egraph, t);
+  print_eterm_def(stdout, egraph, u);
+#endif
+
+  int_hmap2_add(&solver->witness_map, x, y, solver->witness.size);
+  ivector_push(&solver->witness, l);
+
+  return l;
+}
+
+
+/*
+ * Create the extensionality axiom for (x != y)
+ * - x and y must have the same domain
+ */
+static void fun_solver_extensionality_axiom(fun_solver_t *solver, thvar_t x, thvar_t y) {
+  fun_vartable_t *vtbl;
+  egraph_t *egraph;
+  literal_t l1, l2;
+
+  assert(0 <= x && x < solver->vtbl.nvars && 0 <= y && y < solver->vtbl.nvars && x != y);
+
+  egraph = solver->egraph;
+  vtbl = &solver->vtbl;
+  l1 = fun_solver_witness(solver, x, y);
   l2 = egraph_make_eq(egraph, pos_occ(vtbl->eterm[x]), pos_occ(vtbl->eterm[y]));
 
 #if 0
@@ -1069,9 +1115,6 @@ static void fun_solver_extensionality_axiom(fun_solver_t *solver, thvar_t x, thv
   printf("\n---- Extensionality axiom for f!%"PRId32" /= f!%"PRId32" ----\n", x, y);
   print_eterm_def(stdout, solver->egraph, vtbl->eterm[x]);
   print_eterm_def(stdout, solver->egraph, vtbl->eterm[y]);
-  printf("New terms:\n");
-  print_eterm_def(stdout, egraph, t);
-  print_eterm_def(stdout, egraph, u);
   printf("Atoms:\n");
   print_literal(stdout, l1);
   printf(" := ");
@@ -1091,8 +1134,6 @@ static void fun_solver_extensionality_axiom(fun_solver_t *solver, thvar_t x, thv
 
   add_binary_clause(solver->core, not(l1), l2);
 
-  ivector_reset(v);
-
   solver->stats.num_extensionality_axiom ++;
 }
 
@@ -1742,6 +1783,156 @@ static thvar_t root_app_var(egraph_t *egraph, composite_t *c) {
 }
 
 
+/*
+ * Check whether there's an update conflict for c anywhere in the
+ * weak-equivalence class of x for c's arguments, that is, the set of
+ * root variables reachable from x via paths that don't mask c's arguments.
+ * - x must be a root variable, not visited yet, and c = (apply f ...)
+ *   where f belongs to the class of x
+ * - unlike update_conflict_for_application, this doesn't stop at nodes
+ *   that have a composite equal to c and doesn't generate any lemma
+ * - all the nodes reached are added to the queue and their pre field is set.
+ *   They're left there until reset_update_search is called.
+ */
+static bool weq_class_has_conflict(fun_solver_t *solver, thvar_t x, composite_t *c) {
+  fun_queue_t *queue;
+  egraph_t *egraph;
+  fun_vartable_t *vtbl;
+  composite_t *d;
+  int32_t *edges;
+  thvar_t y, z;
+  uint32_t n, i;
+  int32_t k;
+  bool result;
+
+  egraph = solver->egraph;
+  vtbl = &solver->vtbl;
+  assert(vtbl->root[x] == x && vtbl->pre[x] < 0);
+  queue = &solver->queue;
+  assert(empty_fun_queue(queue));
+
+  fun_queue_push(queue, x);
+  vtbl->pre[x] = null_fun_pred;
+
+  result = false;
+  while (! empty_fun_queue(queue)) {
+    z = fun_queue_pop(queue);
+    assert(vtbl->root[z] == z);
+
+    if (z != x) {
+      d = egraph_find_modified_application(egraph, vtbl->eterm[z], c);
+      if (d != NULL_COMPOSITE && ! egraph_equal_apps(egraph, c, d)) {
+        result = true;
+      }
+    }
+
+    do {
+      edges = vtbl->edges[z];
+      if (edges != NULL) {
+        n = iv_size(edges);
+        for (i=0; i<n; i++) {
+          k = edges[i];
+          y = adjacent_root(solver, z, k);
+          if (vtbl->pre[y] < 0 && !masking_edge(solver, k, c)) {
+            fun_queue_push(queue, y);
+            vtbl->pre[y] = k;
+          }
+        }
+      }
+      z = vtbl->next[z];
+    } while (z != null_thvar);
+  }
+
+  return result;
+}
+
+
+/*
+ * Reset pre[y] to null for all y in the queue and empty the queue
+ */
+static void reset_update_search(fun_solver_t *solver) {
+  fun_queue_t *queue;
+  fun_vartable_t *vtbl;
+  uint32_t i, n;
+  thvar_t y;
+
+  vtbl = &solver->vtbl;
+  queue = &solver->queue;
+  n = queue->top;
+  for (i=0; i<n; i++) {
+    y = queue->data[i];
+    assert(vtbl->pre[y] >= 0);
+    vtbl->pre[y] = null_fun_edge;
+  }
+  reset_fun_queue(queue);
+}
+
+
+/*
+ * Mark the root variables that need a search in a class of applications
+ * - v = vector of composites (apply f i_1 ... i_n) that all have
+ *   arguments equal in the egraph, so the same edges are masking for all of them
+ * - m = size of v
+ * - the weak-equivalence classes for these arguments are disjoint. We
+ *   explore each of them once (from the first composite of v that
+ *   belongs to it) to check whether it contains a conflict.
+ * - all the nodes of the classes that have a conflict are marked and
+ *   added to solver->weq_nodes
+ * - return true if there's at least one conflict
+ *
+ * A composite of v whose root is not marked can't have an update
+ * conflict, so update_conflicts skips it.
+ */
+static bool mark_weq_conflicts(fun_solver_t *solver, void **v, uint32_t m) {
+  fun_vartable_t *vtbl;
+  fun_queue_t *queue;
+  composite_t *c;
+  uint32_t i, j, start;
+  thvar_t x;
+  bool result;
+
+  vtbl = &solver->vtbl;
+  queue = &solver->queue;
+  assert(queue->top == 0);
+
+  result = false;
+  for (j=0; j<m; j++) {
+    c = v[j];
+    x = root_app_var(solver->egraph, c);
+    if (vtbl->pre[x] < 0) {
+      start = queue->top;
+      if (weq_class_has_conflict(solver, x, c)) {
+        for (i=start; i<queue->top; i++) {
+          set_bit(vtbl->mark, queue->data[i]);
+          ivector_push(&solver->weq_nodes, queue->data[i]);
+        }
+        result = true;
+      }
+    }
+  }
+
+  reset_update_search(solver);
+
+  return result;
+}
+
+
+/*
+ * Clear the marks set by mark_weq_conflicts
+ */
+static void clear_weq_marks(fun_solver_t *solver) {
+  ivector_t *v;
+  uint32_t i, n;
+
+  v = &solver->weq_nodes;
+  n = v->size;
+  for (i=0; i<n; i++) {
+    clr_bit(solver->vtbl.mark, v->data[i]);
+  }
+  ivector_reset(v);
+}
+
+
 /*
  * Collect all applications and check for update conflicts
  * - the equivalence classes and roots must be set first
@@ -1767,26 +1958,38 @@ static bool update_conflicts(fun_solver_t *solver) {
   result = false;
   num_updates = 0;
 
-  // get the partition and process all composites that
-  // are in a non-singleton class
+  /*
+   * Get the partition and process all composites that are in a
+   * non-singleton class. For each class, we first check which
+   * weak-equivalence classes contain a conflict (each node is visited
+   * once). The search for a lemma is then restricted to the composites
+   * whose root is in these classes.
+   */
   pp = egraph_app_partition(egraph);
   n = ptr_partition_nclasses(pp);
   for (i=0; i<n; i++) {
     v = pp->classes[i];
     m = ppv_size(v);
     assert(m >= 2);
+    if (! mark_weq_conflicts(solver, v, m)) {
+      continue;
+    }
     for (j=0; j<m; j++) {
       c = v[j];
       x = root_app_var(egraph, c);
-      if (update_conflict_for_application(solver, x, c)) {
+      if (tst_bit(solver->vtbl.mark, x) && update_conflict_for_application(solver, x, c)) {
         result = true;
         num_updates ++;
         // exit if max_update_conflicts is reached
         // move to the next class otherwise
-        if (num_updates >= solver->max_update_conflicts) goto done;
+        if (num_updates >= solver->max_update_conflicts) {
+          clear_weq_marks(solver);
+          goto done;
+        }
         break;
       }
     }
+    clear_weq_marks(solver);
   }
 
 
@@ -1870,10 +2073,13 @@ void init_fun_solver(fun_solver_t *solver, smt_core_t *core,
   init_fun_queue(&solver->queue);
   init_diseq_stack(&solver->dstack);
   init_fun_trail_stack(&solver->trail_stack);
+  init_int_hmap2(&solver->witness_map, 0);
+  init_ivector(&solver->witness, 0);
 
   init_ivector(&solver->aux_vector, 10);
   init_ivector(&solver->lemma_vector, 10);
   init_pvector(&solver->app_vector, 10);
+  init_ivector(&solver->weq_nodes, 10);
 
   solver->apps_ready = false;
   solver->bases_ready = false;
@@ -1899,10 +2105,13 @@ void delete_fun_solver(fun_solver_t *solver) {
   delete_fun_queue(&solver->queue);
   delete_diseq_stack(&solver->dstack);
   delete_fun_trail_stack(&solver->trail_stack);
+  delete_int_hmap2(&solver->witness_map);
+  delete_ivector(&solver->witness);
 
   delete_ivector(&solver->aux_vector);
   delete_ivector(&solver->lemma_vector);
   delete_pvector(&solver->app_vector);
+  delete_ivector(&solver->weq_nodes);
 
   if (solver->value != NULL) {
     fun_solver_delete_values(solver);
@@ -1935,10 +2144,13 @@ void fun_solver_reset(fun_solver_t *solver) {
   reset_fun_queue(&solver->queue);
   reset_diseq_stack(&solver->dstack);
   reset_fun_trail_stack(&solver->trail_stack);
+  reset_int_hmap2(&solver->witness_map);
+  ivector_reset(&solver->witness);
 
   ivector_reset(&solver->aux_vector);
   ivector_reset(&solver->lemma_vector);
   pvector_reset(&solver->app_vector);
+  ivector_reset(&solver->weq_nodes);
 
   solver->apps_ready = false;
   solver->bases_ready = false;
@@ -1996,13 +2208,21 @@ void fun_solver_backtrack(fun_solver_t *solver, uint32_t back_level) {
 void fun_solver_push(fun_solver_t *solver) {
   assert(solver->base_level == solver->decision_level);
 
-  fun_trail_stack_save(&solver->trail_stack, solver->vtbl.nvars, solver->etbl.nedges);
+  fun_trail_stack_save(&solver->trail_stack, solver->vtbl.nvars, solver->etbl.nedges, solver->witness.size);
   solver->base_level ++;
   fun_solver_increase_decision_level(solver);
   assert(solver->base_level == solver->decision_level);
 }
 
 
+/*
+ * Keep-alive function for the witness map: aux is a pointer to
+ * the number of witnesses to keep.
+ */
+static bool witness_is_live(void *aux, int_hmap2_rec_t *r) {
+  return (uint32_t) r->val < *((uint32_t *) aux);
+}
+
 /*
  * Pop:
  * - remove variables & edges added at the current base level
@@ -2041,6 +2261,12 @@ void fun_solver_pop(fun_solver_t *solver) {
   shrink_fun_vartable(&solver->vtbl, top->nvars);
   shrink_edge_table(&solver->etbl, top->nedges);
 
+  // remove the witnesses created at this level
+  if (solver->witness.size > top->nwitnesses) {
+    int_hmap2_gc(&solver->witness_map, &top->nwitnesses, witness_is_live);
+    ivector_shrink(&solver->witness, top->nwitnesses);
+  }
+
   solver->base_level --;
   fun_trail_stack_pop(&solver->trail_stack);
 
@@ -2992,29 +3218,28 @@ static void fun_solver_prepare_model(fun_solver_t *solver) {
 /*
  * Generate the lemma l => x1 != x2
  * - we instantiate the extensionality axiom here:
- *   (i.e., we generate the clause (not l) or (x1 t) /= (x2 t) for a
- *    fresh Skolem constant t).
+ *   (i.e., we generate the clause (not l) or (x1 t) /= (x2 t)).
+ * - t is the Skolem constant attached to the pair (x1, x2): it's created
+ *   on the first lemma or extensionality axiom for x1 and x2, then all
+ *   later lemmas on the same pair reuse the witness (see fun_solver_witness).
  */
 static void fun_solver_gen_interface_lemma(fun_solver_t *solver, literal_t l, thvar_t x1, thvar_t x2, bool equiv) {
+#if TRACE
   fun_vartable_t *vtbl;
   egraph_t *egraph;
-  ivector_t *v;
-  eterm_t t, u;
+#endif
   literal_t eq;
 
   solver->reconciled = false;
 
   assert(0 <= x1 && x1 < solver->vtbl.nvars && 0 <= x2 && x2 < solver->vtbl.nvars && x1 != x2);
 
-  egraph = solver->egraph;
+#if TRACE
   vtbl = &solver->vtbl;
-  v = &solver->aux_vector;
-  assert(v->size == 0);
+  egraph = solver->egraph;
+#endif
 
-  fun_solver_skolem_domain(solver, vtbl->type[x1], v);
-  t = egraph_make_apply(egraph, pos_occ(vtbl->eterm[x1]), v->size, v->data, fun_var_range_type(solver, x1));
-  u = egraph_make_apply(egraph, pos_occ(vtbl->eterm[x2]), v->size, v->data, fun_var_range_type(solver, x2));
-  eq = egraph_make_eq(egraph, pos_occ(t), pos_occ(u));
+  eq = fun_solver_witness(solver, x1, x2);
 
 #if 0
   printf("---> ARRAY SOLVER: interface lemma for f!%"PRId32" /= f!%"PRId32" ----\n", x1, x2);
@@ -3024,9 +3249,6 @@ static void fun_solver_gen_interface_lemma(fun_solver_t *solver, literal_t l, th
   printf("\n---> Array solver: reconciliation lemma for f!%"PRId32" /= f!%"PRId32" ----\n", x1, x2);
   print_eterm_def(stdout, solver->egraph, vtbl->eterm[x1]);
   print_eterm_def(stdout, solver->egraph, vtbl->eterm[x2]);
-  printf("New terms:\n");
-  print_eterm_def(stdout, egraph, t);
-  print_eterm_def(stdout, egraph, u);
   printf("Antecedent:\n");
   print_literal(stdout, l);
   printf(" := ");
@@ -3047,8 +3269,6 @@ static void fun_solver_gen_interface_lemma(fun_solver_t *solver, literal_t l, th
 
   add_binary_clause(solver->core, not(l), not(eq));
 
-  ivector_reset(v);
-
   solver->stats.num_extensionality_axiom ++;
 }
 
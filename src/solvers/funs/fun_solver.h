@@ -166,10 +166,12 @@ typedef struct fun_queue_s {
 /*
  * Trailer stack:
  * - for every push: keep number of variables + number of edges
+ *   + number of extensionality witnesses
  */
 typedef struct fun_trail_s {
   uint32_t nvars;
   uint32_t nedges;
+  uint32_t nwitnesses;
 } fun_trail_t;
 
 typedef struct fun_trail_stack_s {
@@ -243,12 +245,27 @@ typedef struct fun_solver_s {
    */
   fun_trail_stack_t trail_stack;
 
+  /*
+   * Extensionality witnesses:
+   * - for two variables x < y, witness_map maps (x, y) to an index k
+   *   and witness[k] is the literal (= (x i_1 ... i_n) (y i_1 ... i_n))
+   *   where i_1 ... i_n are the Skolem constants created for x and y.
+   * - the same Skolem constants are reused by all extensionality axioms
+   *   and interface lemmas on x and y, so repeated instantiations don't
+   *   create new terms and atoms.
+   * - witnesses created after a push are removed on pop.
+   */
+  int_hmap2_t witness_map;
+  ivector_t witness;
+
   /*
    * Buffers
+   * - weq_nodes = nodes marked when searching for update conflicts
    */
   ivector_t aux_vector;
   ivector_t lemma_vector;
   pvector_t app_vector;
+  ivector_t weq_nodes;
 
 
   /*
@@ -54,7 +54,7 @@
  * direct calls to malloc/free.
  */
 typedef struct {
-  object_store_t *store;
+  object_store_t **store;
   uint32_t nstores;
 } bvconst_allocator_t;
 
@@ -101,9 +101,11 @@ static void resize_allocator(bvconst_allocator_t *s, uint32_t n) {
   if (new_size > MAX_NUM_STORES) new_size = MAX_NUM_STORES;
   assert(new_size <= MAX_NUM_STORES);
     
-  s->store = (object_store_t *) safe_realloc(s->store, new_size * sizeof(object_store_t));
+  // the stores themselves must not move (cf. object_stores.h)
+  s->store = (object_store_t **) safe_realloc(s->store, new_size * sizeof(object_store_t *));
   for (i=s->nstores; i<new_size; i++) {
-    init_objstore(s->store + i, (2 * i) * sizeof(uint32_t), BVCONST_BANK_SIZE);
+    s->store[i] = (object_store_t *) safe_malloc(sizeof(object_store_t));
+    init_objstore(s->store[i], (2 * i) * sizeof(uint32_t), BVCONST_BANK_SIZE);
   }
   s->nstores = new_size;
 }
@@ -124,7 +126,7 @@ static uint32_t *alloc_vector(bvconst_allocator_t *s, uint32_t k) {
     if (i >= s->nstores) {
       resize_allocator(s, i);
     }
-    m = s->store + i;
+    m = s->store[i];
     assert(m->objsize >= k * sizeof(uint32_t));
     p = (uint32_t *) objstore_alloc(m);
   } else {
@@ -145,7 +147,7 @@ static void free_vector(bvconst_allocator_t *s, uint32_t *bv, uint32_t k) {
   i = ((k + 1) >> 1);
   if (i < MAX_NUM_STORES) {
     assert(0 < i && i < s->nstores);
-    objstore_free(s->store + i, (void *) bv);
+    objstore_free(s->store[i], (void *) bv);
   } else {
     safe_free(bv);
   }
@@ -159,7 +161,8 @@ static void delete_allocator(bvconst_allocator_t *s) {
   uint32_t i;
 
   for (i=0; i<s->nstores; i++) {
-    delete_objstore(s->store + i);
+    delete_objstore(s->store[i]);
+    safe_free(s->store[i]);
   }
   safe_free(s->store);
   s->store = NULL;
@@ -30,6 +30,23 @@
 #include "terms/mpq_stores.h"
 #include "mt/thread_macros.h"
 
+#ifdef THREAD_SAFE
+
+/*
+ * Empty all the magazines (their mpq_links belong to the banks)
+ */
+static void mpqstore_clear_magazines(mpq_store_t *s) {
+  uint32_t i;
+
+  for (i=0; i<MPQSTORE_MAGAZINES; i++) {
+    s->mag[i].m.list = NULL;
+    s->mag[i].m.count = 0;
+  }
+}
+
+#endif
+
+
 /*
  * Initialize s:
  */
@@ -37,13 +54,23 @@ static void _o_init_mpqstore(mpq_store_t *s) {
   s->bnk = NULL;
   s->free_list = NULL;
   s->free_index = 0;
+#ifdef THREAD_SAFE
+  mpqstore_clear_magazines(s);
+#endif
 }
 
+#ifdef THREAD_SAFE
+static void mpqstore_thread_exit(yices_thread_exit_handler_t *h, uint32_t i);
+#endif
+
 void init_mpqstore(mpq_store_t *s) {
 #ifdef THREAD_SAFE
   create_yices_lock(&(s->lock));
 #endif
   MT_PROTECT_VOID(s->lock, _o_init_mpqstore(s));
+#ifdef THREAD_SAFE
+  register_thread_exit_handler(&s->exit_handler, mpqstore_thread_exit, s);
+#endif
 }
 
 
@@ -82,10 +109,96 @@ static mpq_ptr _o_mpqstore_alloc(mpq_store_t *s) {
   return (mpq_ptr) &obj->mpq; //same as obj
 }
 
+#ifdef THREAD_SAFE
+
+/*
+ * Move MPQSTORE_BATCH new mpq_links into magazine m
+ */
+static void _o_mpqstore_refill(mpq_store_t *s, mpq_magazine_t *m) {
+  mpq_link_t *obj;
+  uint32_t i;
+
+  for (i=0; i<MPQSTORE_BATCH; i++) {
+    obj = (mpq_link_t *) _o_mpqstore_alloc(s);
+    obj->next = m->m.list;
+    m->m.list = obj;
+  }
+  m->m.count += MPQSTORE_BATCH;
+}
+
+/*
+ * Move MPQSTORE_BATCH mpq_links from magazine m to s->free_list
+ */
+static void _o_mpqstore_flush(mpq_store_t *s, mpq_magazine_t *m) {
+  mpq_link_t *obj;
+  uint32_t i;
+
+  assert(m->m.count >= MPQSTORE_BATCH);
+
+  for (i=0; i<MPQSTORE_BATCH; i++) {
+    obj = m->m.list;
+    m->m.list = obj->next;
+    obj->next = s->free_list;
+    s->free_list = obj;
+  }
+  m->m.count -= MPQSTORE_BATCH;
+}
+
+/*
+ * Exit handler: move all mpq_links of magazine i to s->free_list
+ * - this is called when thread i exits
+ */
+static void _o_mpqstore_flush_all(mpq_store_t *s, mpq_magazine_t *m) {
+  mpq_link_t *obj;
+
+  while (m->m.list != NULL) {
+    obj = m->m.list;
+    m->m.list = obj->next;
+    obj->next = s->free_list;
+    s->free_list = obj;
+  }
+  m->m.count = 0;
+}
+
+static void mpqstore_thread_exit(yices_thread_exit_handler_t *h, uint32_t i) {
+  mpq_store_t *s;
+
+  s = h->data;
+  if (i < MPQSTORE_MAGAZINES) {
+    MT_PROTECT_VOID(s->lock, _o_mpqstore_flush_all(s, s->mag + i));
+  }
+}
+
+mpq_ptr mpqstore_alloc(mpq_store_t *s) {
+  mpq_magazine_t *m;
+  mpq_link_t *obj;
+  uint32_t i;
+
+  i = yices_thread_index();
+  if (i < MPQSTORE_MAGAZINES) {
+    m = s->mag + i;
+    if (m->m.count == 0) {
+      MT_PROTECT_VOID(s->lock, _o_mpqstore_refill(s, m));
+    }
+    assert(m->m.count > 0 && m->m.list != NULL);
+    obj = m->m.list;
+    m->m.list = obj->next;
+    m->m.count --;
+    obj->next = NULL;  //sanity check: when returned it should still be NULL
+    return (mpq_ptr) &obj->mpq;
+  }
+
+  MT_PROTECT(mpq_ptr , s->lock, _o_mpqstore_alloc(s));
+}
+
+#else
+
 mpq_ptr mpqstore_alloc(mpq_store_t *s) {
   MT_PROTECT(mpq_ptr , s->lock, _o_mpqstore_alloc(s));
 }
 
+#endif
+
 
 /*
  * Delete all mpqs
@@ -111,9 +224,15 @@ static void _o_delete_mpqstore(mpq_store_t *s) {
   s->bnk = NULL;
   s->free_list = NULL;
   s->free_index = 0;
+#ifdef THREAD_SAFE
+  mpqstore_clear_magazines(s);
+#endif
 }
 
 void delete_mpqstore(mpq_store_t *s) {
+#ifdef THREAD_SAFE
+  unregister_thread_exit_handler(&s->exit_handler);
+#endif
   MT_PROTECT_VOID(s->lock, _o_delete_mpqstore(s));
 #ifdef THREAD_SAFE
   destroy_yices_lock(&(s->lock));
@@ -135,7 +254,35 @@ static void _o_mpqstore_free(mpq_store_t *s, mpq_ptr mpq) {
 }
 
 
+#ifdef THREAD_SAFE
+
+void mpqstore_free(mpq_store_t *s, mpq_ptr mpq) {
+  mpq_magazine_t *m;
+  mpq_link_t *obj;
+  uint32_t i;
+
+  i = yices_thread_index();
+  if (i < MPQSTORE_MAGAZINES) {
+    m = s->mag + i;
+    obj = (mpq_link_t *) mpq;
+    assert(obj->next == NULL); //sanity check: it's being returned; it should still be NULL
+    obj->next = m->m.list;
+    m->m.list = obj;
+    m->m.count ++;
+    if (m->m.count >= 2 * MPQSTORE_BATCH) {
+      MT_PROTECT_VOID(s->lock, _o_mpqstore_flush(s, m));
+    }
+    return;
+  }
+
+  MT_PROTECT_VOID(s->lock, _o_mpqstore_free(s, mpq));
+}
+
+#else
+
 void mpqstore_free(mpq_store_t *s, mpq_ptr mpq) {
   MT_PROTECT_VOID(s->lock, _o_mpqstore_free(s, mpq));
 }
 
+#endif
+
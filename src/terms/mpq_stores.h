@@ -58,15 +58,42 @@ struct mpq_bank_s {
   mpq_link_t block[MPQ_BLOCK_COUNT];
 };
 
+#ifdef THREAD_SAFE
+/*
+ * Magazine = a private list of free mpq_links for one thread
+ * (same scheme as in utils/object_stores.h)
+ * - thread i (as given by yices_thread_index) owns magazine i
+ *   if i < MPQSTORE_MAGAZINES
+ * - links are moved between a magazine and the shared free list
+ *   by batches of MPQSTORE_BATCH
+ * - when thread i exits, magazine i is emptied into the shared free list
+ */
+typedef union mpq_magazine_u {
+  struct {
+    mpq_link_t *list;
+    uint32_t count;
+  } m;
+  char padding[64];
+} mpq_magazine_t;
+
+#define MPQSTORE_MAGAZINES 16
+#define MPQSTORE_BATCH 32
+
+#endif
+
 /*
  * Store = a list of blocks
  * - allocations are performed via a free list,
  * - or in the first block of the bank list,
  * - or by adding a new block.
+ * In THREAD_SAFE mode, the lock is taken only to refill or flush
+ * a thread's magazine.
  */
 typedef struct mpq_store_s {
 #ifdef THREAD_SAFE
   yices_lock_t lock;        // a lock protecting the mpq_store
+  yices_thread_exit_handler_t exit_handler;
+  mpq_magazine_t mag[MPQSTORE_MAGAZINES];
 #endif
   mpq_bank_t *bnk;          // first block in the bank list
   mpq_link_t *free_list;    // list of free mpq_links
@@ -48,6 +48,9 @@ void init_pprod_table(pprod_table_t *table, uint32_t n) {
 
   init_int_htbl(&table->htbl, 0); // default size
   init_pp_buffer(&table->buffer, 10);
+
+  init_ivector(&table->young, 0);
+  table->track_young = false;
 }
 
 
@@ -78,6 +81,8 @@ void reset_pprod_table(pprod_table_t *table) {
   table->free_idx = -1;
   reset_int_htbl(&table->htbl);
   pp_buffer_reset(&table->buffer);
+  ivector_reset(&table->young);
+  table->track_young = false;
 }
 
 
@@ -102,10 +107,28 @@ void delete_pprod_table(pprod_table_t *table) {
 
   delete_int_htbl(&table->htbl);
   delete_pp_buffer(&table->buffer);
+  delete_ivector(&table->young);
 }
 
 
 
+/*
+ * Stop tracking the young generation if it's larger than half the table
+ */
+#define PPROD_YOUNG_GEN_MIN_SIZE 1024
+
+static void check_young_size(pprod_table_t *table) {
+  uint32_t n;
+
+  n = table->young.size;
+  if (n > PPROD_YOUNG_GEN_MIN_SIZE && n > (table->nelems >> 1)) {
+    delete_ivector(&table->young);
+    init_ivector(&table->young, 0);
+    table->track_young = false;
+  }
+}
+
+
 /*
  * Allocate an index i such that data[i] is empty
  * - clear mark[i]
@@ -127,6 +150,10 @@ static int32_t allocate_pprod_id(pprod_table_t *table) {
   }
 
   clr_bit(table->mark, i);
+  if (table->track_young) {
+    ivector_push(&table->young, i);
+    check_young_size(table);
+  }
 
   return i;
 }
@@ -358,28 +385,75 @@ void pprod_table_set_gc_mark(pprod_table_t *table, pprod_t *p) {
 }
 
 
+/*
+ * Clear the mark on p
+ */
+void pprod_table_clr_gc_mark(pprod_table_t *table, pprod_t *p) {
+  int32_t i;
+
+  i = find_pprod_id(table, p);
+  assert(i >= 0 && table->data[i] == p);
+  clr_bit(table->mark, i);
+}
+
+
+/*
+ * Delete product i if it's not marked
+ */
+static void gc_pprod_id(pprod_table_t *table, int32_t i) {
+  pprod_t *p;
+  uint32_t h;
+
+  if (! tst_bit(table->mark, i)) {
+    // i is not marked
+    p = table->data[i];
+    if (!has_int_tag(p)) {
+      // not already deleted
+      h = hash_varexp_array(p->prod, p->len);
+      erase_pprod_id(table, i);
+      int_htbl_erase_record(&table->htbl, h, i);
+    }
+  }
+}
+
+
 /*
  * Garbage collection: delete all unmarked products
  * clear all the marks
  */
 void pprod_table_gc(pprod_table_t *table) {
-  pprod_t *p;
-  uint32_t i, n, h;
+  uint32_t i, n;
 
   n = table->nelems;
   for (i=0; i<n; i++) {
-    if (! tst_bit(table->mark, i)) {
-      // i is not marked
-      p = table->data[i];
-      if (!has_int_tag(p)) {
-        // not already deleted
-        h = hash_varexp_array(p->prod, p->len);
-        erase_pprod_id(table, i);
-        int_htbl_erase_record(&table->htbl, h, i);
-      }
-    }
+    gc_pprod_id(table, i);
   }
 
   // clear all the marks
   clear_bitvector(table->mark, table->size);
+
+  // start a new young generation
+  ivector_reset(&table->young);
+  table->track_young = true;
+}
+
+
+/*
+ * Minor collection: delete the unmarked young products
+ * clear the marks of the young products
+ */
+void pprod_table_minor_gc(pprod_table_t *table) {
+  uint32_t i, n;
+  int32_t k;
+
+  assert(table->track_young);
+
+  n = table->young.size;
+  for (i=0; i<n; i++) {
+    k = table->young.data[i];
+    gc_pprod_id(table, k);
+    clr_bit(table->mark, k);
+  }
+
+  ivector_reset(&table->young);
 }
@@ -24,10 +24,12 @@
 #define __PPROD_TABLE_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "terms/power_products.h"
 #include "utils/bitvectors.h"
 #include "utils/int_hash_tables.h"
+#include "utils/int_vectors.h"
 
 
 /*
@@ -46,6 +48,12 @@
  * - free_idx = start of the free list (-1 means that the free list is empty)
  * - htbl = hash table for hash consing
  * - buffer = buffer for constructing power products
+ *
+ * Young generation (cf. term_table_minor_gc):
+ * - track_young is false until the first call to pprod_table_gc
+ * - if track_young is true, young stores the indices of the products
+ *   created since the last garbage collection
+ * - tracking stops if young gets larger than half the table
  */
 typedef struct pprod_table_s {
   pprod_t **data;
@@ -57,6 +65,9 @@ typedef struct pprod_table_s {
 
   int_htbl_t htbl;
   pp_buffer_t buffer;
+
+  ivector_t young;
+  bool track_young;
 } pprod_table_t;
 
 
@@ -147,6 +158,12 @@ extern void delete_pprod(pprod_table_t *table, pprod_t *p);
  */
 extern void pprod_table_set_gc_mark(pprod_table_t *table, pprod_t *p);
 
+/*
+ * Clear the mark on p
+ * - p must be present in the table
+ */
+extern void pprod_table_clr_gc_mark(pprod_table_t *table, pprod_t *p);
+
 /*
  * Call the garbage collector:
  * - delete every product not marked
@@ -154,5 +171,17 @@ extern void pprod_table_set_gc_mark(pprod_table_t *table, pprod_t *p);
  */
 extern void pprod_table_gc(pprod_table_t *table);
 
+/*
+ * Delete every product created since the last garbage collection
+ * that's not marked, then clear the marks of the young products.
+ * - this must be called only if the young generation is tracked
+ * - the marks of older products must be cleared by the caller
+ */
+extern void pprod_table_minor_gc(pprod_table_t *table);
+
+static inline bool pprod_table_tracks_young(pprod_table_t *table) {
+  return table->track_young;
+}
+
 
 #endif /* __PPROD_TABLE_H */
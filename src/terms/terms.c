@@ -145,6 +145,14 @@ static void term_table_init(term_table_t *table, uint32_t n, type_table_t *ttbl,
   init_stbl(&table->stbl, 0);
   init_ptr_hmap(&table->ntbl, 0);
   init_int_hmap(&table->utbl, 0);
+  init_objstore(&table->composites, SMALL_COMPOSITE_SIZE, SMALL_COMPOSITE_BLOCK);
+
+  // young generation: not tracked until the first collection
+  init_ivector(&table->young, 0);
+  init_ivector(&table->young_named, 0);
+  init_ivector(&table->marked, 0);
+  table->track_young = false;
+  table->minor_gc = false;
 
   // attach the name finalizer to stbl
   stbl_set_finalizer(&table->stbl, term_name_finalizer);
@@ -183,6 +191,26 @@ static void term_table_extend(term_table_t *table) {
  * TERM ALLOCATION
  */
 
+/*
+ * Stop tracking the young generation if it's larger than half the
+ * table (and larger than YOUNG_GEN_MIN_SIZE): a minor collection
+ * would not be cheaper than a full one. The next minor collection
+ * does a full collection, which starts a new young generation.
+ * - n = size of the young or young_named vector
+ */
+#define YOUNG_GEN_MIN_SIZE 1024
+
+static void check_young_size(term_table_t *table, uint32_t n) {
+  if (n > YOUNG_GEN_MIN_SIZE && n > (table->live_terms >> 1)) {
+    delete_ivector(&table->young);
+    delete_ivector(&table->young_named);
+    init_ivector(&table->young, 0);
+    init_ivector(&table->young_named, 0);
+    table->track_young = false;
+  }
+}
+
+
 /*
  * Allocate a new term id
  * - clear its mark. Nothing else is initialized.
@@ -203,6 +231,10 @@ static int32_t allocate_term_id(term_table_t *table) {
   }
   clr_bit(table->mark, i);
   table->live_terms ++;
+  if (table->track_young) {
+    ivector_push(&table->young, i);
+    check_young_size(table, table->young.size);
+  }
 
   return i;
 }
@@ -318,19 +350,47 @@ static root_atom_t* new_root_atom(term_table_t *table, uint32_t k, term_t x, ter
 #define MAX_COMPOSITE_TERM_ARITY ((UINT32_MAX-sizeof(composite_term_t))/sizeof(term_t))
 
 
+/*
+ * Allocate a descriptor of arity n (the arity field is set)
+ * - small descriptors come from table->composites
+ */
+static composite_term_t *alloc_composite_term(term_table_t *table, uint32_t n) {
+  composite_term_t *d;
+
+  assert(n <= MAX_COMPOSITE_TERM_ARITY);
+
+  if (n <= SMALL_COMPOSITE_ARITY) {
+    d = (composite_term_t *) objstore_alloc(&table->composites);
+  } else {
+    d = (composite_term_t *) safe_malloc(sizeof(composite_term_t) + n * sizeof(term_t));
+  }
+  d->arity = n;
+
+  return d;
+}
+
+/*
+ * Free descriptor d (allocated by alloc_composite_term)
+ */
+static void free_composite_term(term_table_t *table, composite_term_t *d) {
+  if (d->arity <= SMALL_COMPOSITE_ARITY) {
+    objstore_free(&table->composites, d);
+  } else {
+    safe_free(d);
+  }
+}
+
+
 /*
  * Generic n-ary term:
  * - n = arity
  * - a[0 ... n-1] = components
  */
-static composite_term_t *new_composite_term(uint32_t n, const term_t *a) {
+static composite_term_t *new_composite_term(term_table_t *table, uint32_t n, const term_t *a) {
   composite_term_t *d;
   uint32_t j;
 
-  assert(n <= MAX_COMPOSITE_TERM_ARITY);
-
-  d = (composite_term_t *) safe_malloc(sizeof(composite_term_t) + n * sizeof(term_t));
-  d->arity = n;
+  d = alloc_composite_term(table, n);
   for (j=0; j<n; j++) {
     d->arg[j] = a[j];
   }
@@ -345,14 +405,13 @@ static composite_term_t *new_composite_term(uint32_t n, const term_t *a) {
  * - n = arity
  * - a[0 ... n-1] = arguments to f
  */
-static composite_term_t *new_app_term(term_t f, uint32_t n, const term_t *a) {
+static composite_term_t *new_app_term(term_table_t *table, term_t f, uint32_t n, const term_t *a) {
   composite_term_t *d;
   uint32_t j;
 
   assert(n <= MAX_COMPOSITE_TERM_ARITY - 1);
 
-  d = (composite_term_t *) safe_malloc(sizeof(composite_term_t) + (n+1) * sizeof(term_t));
-  d->arity = n+1;
+  d = alloc_composite_term(table, n+1);
   d->arg[0] = f;
   for (j=0; j<n; j++) {
     d->arg[j + 1] = a[j];
@@ -365,14 +424,13 @@ static composite_term_t *new_app_term(term_t f, uint32_t n, const term_t *a) {
 /*
  * Function update: (update f a[0] ... a[n-1] v)
  */
-static composite_term_t *new_update_term(term_t f, uint32_t n, const term_t *a, term_t v) {
+static composite_term_t *new_update_term(term_table_t *table, term_t f, uint32_t n, const term_t *a, term_t v) {
   composite_term_t *d;
   uint32_t j;
 
   assert(n <= MAX_COMPOSITE_TERM_ARITY - 2);
 
-  d = (composite_term_t *) safe_malloc(sizeof(composite_term_t) + (n+2) * sizeof(term_t));
-  d->arity = n+2;
+  d = alloc_composite_term(table, n+2);
   d->arg[0] = f;
   for (j=0; j<n; j++) {
     d->arg[j + 1] = a[j];
@@ -386,14 +444,13 @@ static composite_term_t *new_update_term(term_t f, uint32_t n, const term_t *a,
 /*
  * Quantified term: (forall v[0] ... v[n-1] p)
  */
-static composite_term_t *new_forall_term(uint32_t n, const term_t *v, term_t p) {
+static composite_term_t *new_forall_term(term_table_t *table, uint32_t n, const term_t *v, term_t p) {
   composite_term_t *d;
   uint32_t j;
 
   assert(n <= MAX_COMPOSITE_TERM_ARITY - 1);
 
-  d = (composite_term_t *) safe_malloc(sizeof(composite_term_t) + (n+1) * sizeof(term_t));
-  d->arity = n+1;
+  d = alloc_composite_term(table, n+1);
   for (j=0; j<n; j++) {
     d->arg[j] = v[j];
   }
@@ -406,14 +463,13 @@ static composite_term_t *new_forall_term(uint32_t n, const term_t *v, term_t p)
 /*
  * Lambda term: (lambda v[0] ... v[n-1] t)
  */
-static composite_term_t *new_lambda_term(uint32_t n, const term_t *v, term_t t) {
+static composite_term_t *new_lambda_term(term_table_t *table, uint32_t n, const term_t *v, term_t t) {
   composite_term_t *d;
   uint32_t j;
 
   assert(n <= MAX_COMPOSITE_TERM_ARITY - 1);
 
-  d = (composite_term_t *) safe_malloc(sizeof(composite_term_t) + (n+1) * sizeof(term_t));
-  d->arity = n+1;
+  d = alloc_composite_term(table, n+1);
   for (j=0; j<n; j++) {
     d->arg[j] = v[j];
   }
@@ -1175,7 +1231,7 @@ static int32_t build_rational_hobj(rational_term_hobj_t *o) {
 static int32_t build_composite_hobj(composite_term_hobj_t *o) {
   composite_term_t *d;
 
-  d = new_composite_term(o->arity, o->arg);
+  d = new_composite_term(o->tbl, o->arity, o->arg);
   return new_ptr_term(o->tbl, o->tag, o->tau, d);
 }
 
@@ -1189,28 +1245,28 @@ static int32_t build_special_hobj(composite_term_hobj_t *o) {
 static int32_t build_app_hobj(app_term_hobj_t *o) {
   composite_term_t *d;
 
-  d = new_app_term(o->f, o->n, o->arg);
+  d = new_app_term(o->tbl, o->f, o->n, o->arg);
   return new_ptr_term(o->tbl, APP_TERM, o->tau, d);
 }
 
 static int32_t build_update_hobj(update_term_hobj_t *o) {
   composite_term_t *d;
 
-  d = new_update_term(o->f, o->n, o->arg, o->v);
+  d = new_update_term(o->tbl, o->f, o->n, o->arg, o->v);
   return new_ptr_term(o->tbl, UPDATE_TERM, o->tau, d);
 }
 
 static int32_t build_forall_hobj(forall_term_hobj_t *o) {
   composite_term_t *d;
 
-  d = new_forall_term(o->n, o->v, o->p);
+  d = new_forall_term(o->tbl, o->n, o->v, o->p);
   return new_ptr_term(o->tbl, FORALL_TERM, bool_id, d);
 }
 
 static int32_t build_lambda_hobj(lambda_term_hobj_t *o) {
   composite_term_t *d;
 
-  d = new_lambda_term(o->n, o->v, o->t);
+  d = new_lambda_term(o->tbl, o->n, o->v, o->t);
   return new_ptr_term(o->tbl, LAMBDA_TERM, o->tau, d);
 }
 
@@ -1433,6 +1489,11 @@ void set_term_name(term_table_t *table, term_t t, char *name) {
   // add mapping name --> t in the symbol table
   stbl_add(&table->stbl, name, t);
   string_incref(name);
+
+  if (table->track_young) {
+    ivector_push(&table->young_named, index_of(t));
+    check_young_size(table, table->young_named.size);
+  }
 }
 
 
@@ -1602,7 +1663,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     // Generic composite
     d = table->desc[i].ptr;
     h = hash_composite_term(table->kind[i], d->arity, d->arg);
-    safe_free(d);
+    free_composite_term(table, d);
     break;
 
   case ITE_SPECIAL:
@@ -1619,7 +1680,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 2);
     h = hash_app_term(d->arg[0], n-1, d->arg + 1);
-    safe_free(d);
+    free_composite_term(table, d);
     break;
 
   case UPDATE_TERM:
@@ -1627,7 +1688,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 3);
     h = hash_update_term(d->arg[0], n-2, d->arg + 1, d->arg[n-1]);
-    safe_free(d);
+    free_composite_term(table, d);
     break;
 
   case FORALL_TERM:
@@ -1635,7 +1696,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 2);
     h = hash_forall_term(n-1, d->arg, d->arg[n-1]);
-    safe_free(d);
+    free_composite_term(table, d);
     break;
 
   case LAMBDA_TERM:
@@ -1643,7 +1704,7 @@ static void delete_term(term_table_t *table, int32_t i) {
     n = d->arity;
     assert(n >= 2);
     h = hash_lambda_term(n-1, d->arg, d->arg[n-1]);
-    safe_free(d);
+    free_composite_term(table, d);
     break;
 
   case SELECT_TERM:
@@ -1828,9 +1889,6 @@ static void delete_term_descriptors(term_table_t *table) {
     case ARITH_IDIV:
     case ARITH_MOD:
     case ARITH_DIVIDES_ATOM:
-    case ARITH_ROOT_ATOM:
-    case BV64_CONSTANT:
-    case BV_CONSTANT:
     case BV_ARRAY:
     case BV_DIV:
     case BV_REM:
@@ -1843,6 +1901,12 @@ static void delete_term_descriptors(term_table_t *table) {
     case BV_EQ_ATOM:
     case BV_GE_ATOM:
     case BV_SGE_ATOM:
+      free_composite_term(table, table->desc[i].ptr);
+      break;
+
+    case ARITH_ROOT_ATOM:
+    case BV64_CONSTANT:
+    case BV_CONSTANT:
       safe_free(table->desc[i].ptr);
       break;
 
@@ -1883,10 +1947,15 @@ static void delete_term_descriptors(term_table_t *table) {
 void delete_term_table(term_table_t *table) {
   delete_name_table(&table->ntbl);
   delete_term_descriptors(table);
+  delete_objstore(&table->composites);
   delete_int_hmap(&table->utbl);
   delete_int_htbl(&table->htbl);
   delete_stbl(&table->stbl);
 
+  delete_ivector(&table->young);
+  delete_ivector(&table->young_named);
+  delete_ivector(&table->marked);
+
   delete_ivector(&table->ibuffer);
   delete_pvector(&table->pbuffer);
 
@@ -1931,10 +2000,17 @@ static void reset_name_table(ptr_hmap_t *table) {
 void reset_term_table(term_table_t *table) {
   reset_name_table(&table->ntbl);
   delete_term_descriptors(table);
+  reset_objstore(&table->composites);
   int_hmap_reset(&table->utbl);
   reset_int_htbl(&table->htbl);
   reset_stbl(&table->stbl);
 
+  ivector_reset(&table->young);
+  ivector_reset(&table->young_named);
+  ivector_reset(&table->marked);
+  table->track_young = false;
+  table->minor_gc = false;
+
   ivector_reset(&table->ibuffer);
   pvector_reset(&table->pbuffer);
 
@@ -3718,4 +3794,83 @@ void term_table_gc(term_table_t *table, bool keep_named) {
 
   // clear the marks
   clear_bitvector(table->mark, table->size);
+
+  // all surviving terms are now old
+  ivector_reset(&table->young);
+  ivector_reset(&table->young_named);
+  table->track_young = true;
+}
+
+
+/*
+ * Minor collection: young generation only
+ */
+void term_table_start_minor_gc(term_table_t *table) {
+  assert(term_table_tracks_young(table) && !table->minor_gc && table->marked.size == 0);
+  table->minor_gc = true;
+  table->types->ignore_gc_marks = true;
+}
+
+void term_table_minor_gc(term_table_t *table) {
+  uint32_t i, n;
+  int32_t k;
+
+  assert(table->minor_gc && term_table_tracks_young(table));
+
+  // named young terms are roots
+  n = table->young_named.size;
+  for (i=0; i<n; i++) {
+    k = table->young_named.data[i];
+    if (table->kind[k] != UNUSED_TERM) {
+      term_table_set_gc_mark(table, k);
+    }
+  }
+
+  /*
+   * Propagate the marks: the young subterms of a term t are
+   * created before t, so they occur before t in the young vector.
+   * Visiting this vector in reverse order, we just need to mark
+   * the direct children of every marked term (ptr = 0 prevents
+   * recursive exploration).
+   */
+  i = table->young.size;
+  while (i > 0) {
+    i --;
+    k = table->young.data[i];
+    if (term_idx_is_marked(table, k) && table->kind[k] != UNUSED_TERM) {
+      mark_reachable_terms(table, 0, k);
+    }
+  }
+
+  // delete the unmarked young power products
+  pprod_table_minor_gc(table->pprods);
+
+  // delete the unmarked young terms
+  n = table->young.size;
+  for (i=0; i<n; i++) {
+    k = table->young.data[i];
+    if (! term_idx_is_marked(table, k) && table->kind[k] != UNUSED_TERM) {
+      delete_term(table, k);
+    }
+  }
+
+  /*
+   * Clear the marks: all marked terms are in the marked vector.
+   * The marked power products are the young ones (cleared by
+   * pprod_table_minor_gc) and the ones of marked terms.
+   */
+  n = table->marked.size;
+  for (i=0; i<n; i++) {
+    k = table->marked.data[i];
+    clr_bit(table->mark, k);
+    if (table->kind[k] == POWER_PRODUCT) {
+      pprod_table_clr_gc_mark(table->pprods, table->desc[k].ptr);
+    }
+  }
+  ivector_reset(&table->marked);
+  table->minor_gc = false;
+  table->types->ignore_gc_marks = false;
+
+  ivector_reset(&table->young);
+  ivector_reset(&table->young_named);
 }
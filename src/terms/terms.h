@@ -193,6 +193,7 @@
 #include "utils/int_hash_map.h"
 #include "utils/int_hash_tables.h"
 #include "utils/int_vectors.h"
+#include "utils/object_stores.h"
 #include "utils/ptr_hash_map.h"
 #include "utils/ptr_vectors.h"
 #include "utils/symbol_tables.h"
@@ -442,6 +443,15 @@ typedef union {
 } term_desc_t;
 
 
+/*
+ * Composite descriptors of arity <= SMALL_COMPOSITE_ARITY are
+ * allocated in blocks of SMALL_COMPOSITE_BLOCK objects.
+ */
+#define SMALL_COMPOSITE_ARITY 3
+#define SMALL_COMPOSITE_SIZE (sizeof(composite_term_t) + SMALL_COMPOSITE_ARITY * sizeof(term_t))
+#define SMALL_COMPOSITE_BLOCK 1024
+
+
 /*
  * Finalizer function: this is called when a special_term
  * is deleted (to cleanup the spec->extra field).
@@ -482,6 +492,25 @@ typedef void (*special_finalizer_t)(special_term_t *spec, term_kind_t tag);
  * - htbl = hash table for hash consing
  * - utbl = table to map singleton types to the unique term of that type
  *
+ * Small composites:
+ * - the descriptors of composite terms of arity at most
+ *   SMALL_COMPOSITE_ARITY are allocated in the object store
+ *   composites (all of the same size). This avoids one malloc
+ *   call per term and malloc's per-block overhead.
+ *
+ * Young generation (for term_table_minor_gc):
+ * - track_young is false until the first garbage collection
+ * - if track_young is true, young stores the indices of all terms
+ *   created since the last garbage collection (in creation order),
+ *   and young_named stores the terms that received a name in the
+ *   symbol table since the last garbage collection.
+ * - tracking stops (and both vectors are emptied) when the young
+ *   generation is larger than half the table: a minor collection
+ *   would then cost as much as a full one.
+ * - minor_gc is true during a minor collection. Every term marked
+ *   during a minor collection is recorded in vector marked, so that
+ *   the marks can be cleared without scanning the whole table.
+ *
  * Auxiliary vectors
  * - ibuffer: to store an array of integers
  * - pbuffer: to store an array of pprods
@@ -505,6 +534,13 @@ typedef struct term_table_s {
   stbl_t stbl;
   ptr_hmap_t ntbl;
   int_hmap_t utbl;
+  object_store_t composites;
+
+  ivector_t young;
+  ivector_t young_named;
+  ivector_t marked;
+  bool track_young;
+  bool minor_gc;
 
   ivector_t ibuffer;
   pvector_t pbuffer;
@@ -1712,6 +1748,9 @@ static inline special_term_t *ite_special_desc(const term_table_t *table, term_t
  */
 static inline void term_table_set_gc_mark(term_table_t *table, int32_t i) {
   assert(good_term_idx(table, i));
+  if (table->minor_gc && ! tst_bit(table->mark, i)) {
+    ivector_push(&table->marked, i);
+  }
   set_bit(table->mark, i);
 }
 
@@ -1744,4 +1783,36 @@ static inline bool term_idx_is_marked(const term_table_t *table, int32_t i) {
 extern void term_table_gc(term_table_t *table, bool keep_named);
 
 
+/*
+ * Check whether the young generation is tracked. If it's not (before
+ * the first collection or if the young generation grew too large),
+ * a minor collection is not possible.
+ */
+static inline bool term_table_tracks_young(const term_table_t *table) {
+  return table->track_young && pprod_table_tracks_young(table->pprods);
+}
+
+/*
+ * Collect the young generation only:
+ * - the candidates for deletion are the terms created since the last
+ *   garbage collection. Terms are immutable so an older term can't
+ *   refer to a younger one: all older terms are kept without being
+ *   visited.
+ * - the roots are the terms marked between the calls to
+ *   term_table_start_minor_gc and term_table_minor_gc, and all
+ *   young terms that were given a name since the last collection.
+ * - marks are propagated to the young subterms and power products.
+ *   Dead young terms and power products are deleted. Types are not
+ *   collected, and type marks are ignored during a minor collection.
+ * - then all the marks are cleared.
+ *
+ * The cost is proportional to the size of the young generation plus
+ * the number of marked roots.
+ *
+ * The young generation must be tracked when start is called.
+ */
+extern void term_table_start_minor_gc(term_table_t *table);
+extern void term_table_minor_gc(term_table_t *table);
+
+
 #endif /* __TERMS_H */
@@ -282,6 +282,8 @@ static void type_table_init(type_table_t *table, uint32_t n) {
 
   // macro table: not allocated yet
   table->macro_tbl = NULL;
+
+  table->ignore_gc_marks = false;
 }
 
 
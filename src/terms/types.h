@@ -300,6 +300,9 @@ typedef struct type_mtbl_s {
  * - max_tbl = map tau to its maximal super type
  *
  * Macro table: also allocated on demand
+ *
+ * ignore_gc_marks is true during a minor collection of the term table.
+ * Types are not collected then, so type_table_set_gc_mark does nothing.
  */
 typedef struct type_table_s {
   uint8_t *kind;
@@ -321,6 +324,7 @@ typedef struct type_table_s {
   int_hmap_t *max_tbl;
 
   type_mtbl_t *macro_tbl;
+  bool ignore_gc_marks;
 } type_table_t;
 
 
@@ -1144,7 +1148,9 @@ extern type_t apply_type_matching(type_matcher_t *matcher, type_t tau);
  */
 static inline void type_table_set_gc_mark(type_table_t *tbl, type_t i) {
   assert(good_type(tbl, i));
-  tbl->flags[i] |= TYPE_GC_MARK;
+  if (! tbl->ignore_gc_marks) {
+    tbl->flags[i] |= TYPE_GC_MARK;
+  }
 }
 
 /*
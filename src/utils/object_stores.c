@@ -56,6 +56,23 @@ static bool offset_is_aligned(void *p, void *q) {
 
 
 
+#ifdef THREAD_SAFE
+
+/*
+ * Empty all the magazines (their objects belong to the banks)
+ */
+static void objstore_clear_magazines(object_store_t *s) {
+  uint32_t i;
+
+  for (i=0; i<OBJSTORE_MAGAZINES; i++) {
+    s->mag[i].m.list = NULL;
+    s->mag[i].m.count = 0;
+  }
+}
+
+#endif
+
+
 /*
  * Initialize s:
  * - objsize = size of all objects in s
@@ -73,13 +90,23 @@ static void _o_init_objstore(object_store_t *s, uint32_t objsize, uint32_t n) {
   s->free_index = 0;
   s->objsize = objsize;
   s->blocksize = objsize * n;
+#ifdef THREAD_SAFE
+  objstore_clear_magazines(s);
+#endif
 }
 
+#ifdef THREAD_SAFE
+static void objstore_thread_exit(yices_thread_exit_handler_t *h, uint32_t i);
+#endif
+
 void init_objstore(object_store_t *s, uint32_t objsize, uint32_t n) {
 #ifdef THREAD_SAFE
   create_yices_lock(&(s->lock));
 #endif
   MT_PROTECT_VOID(s->lock, _o_init_objstore(s, objsize, n));
+#ifdef THREAD_SAFE
+  register_thread_exit_handler(&s->exit_handler, objstore_thread_exit, s);
+#endif
 }
 
 
@@ -123,10 +150,98 @@ static void *_o_objstore_alloc(object_store_t *s) {
   return tmp;
 }
 
+#ifdef THREAD_SAFE
+
+/*
+ * Move OBJSTORE_BATCH new objects into magazine m
+ */
+static void _o_objstore_refill(object_store_t *s, object_magazine_t *m) {
+  void *tmp;
+  uint32_t i;
+
+  for (i=0; i<OBJSTORE_BATCH; i++) {
+    tmp = _o_objstore_alloc(s);
+    memcpy(tmp, &m->m.list, sizeof(void*));
+    m->m.list = tmp;
+  }
+  m->m.count += OBJSTORE_BATCH;
+}
+
+/*
+ * Move OBJSTORE_BATCH objects from magazine m to s->free_list
+ */
+static void _o_objstore_flush(object_store_t *s, object_magazine_t *m) {
+  void *tmp;
+  uint32_t i;
+
+  assert(m->m.count >= OBJSTORE_BATCH);
+
+  for (i=0; i<OBJSTORE_BATCH; i++) {
+    tmp = m->m.list;
+    memcpy(&m->m.list, tmp, sizeof(void*));
+    memcpy(tmp, &s->free_list, sizeof(void*));
+    s->free_list = tmp;
+  }
+  m->m.count -= OBJSTORE_BATCH;
+}
+
+/*
+ * Exit handler: move all objects of magazine i to s->free_list
+ * - this is called when thread i exits
+ */
+static void _o_objstore_flush_all(object_store_t *s, object_magazine_t *m) {
+  void *tmp;
+
+  while (m->m.list != NULL) {
+    tmp = m->m.list;
+    memcpy(&m->m.list, tmp, sizeof(void*));
+    memcpy(tmp, &s->free_list, sizeof(void*));
+    s->free_list = tmp;
+  }
+  m->m.count = 0;
+}
+
+static void objstore_thread_exit(yices_thread_exit_handler_t *h, uint32_t i) {
+  object_store_t *s;
+
+  s = h->data;
+  if (i < OBJSTORE_MAGAZINES) {
+    MT_PROTECT_VOID(s->lock, _o_objstore_flush_all(s, s->mag + i));
+  }
+}
+
 void *objstore_alloc(object_store_t *s) {
+  object_magazine_t *m;
+  void *tmp;
+  uint32_t i;
+
+  i = yices_thread_index();
+  if (i < OBJSTORE_MAGAZINES) {
+    m = s->mag + i;
+    if (m->m.count == 0) {
+      MT_PROTECT_VOID(s->lock, _o_objstore_refill(s, m));
+    }
+    assert(m->m.count > 0 && m->m.list != NULL);
+    tmp = m->m.list;
+    memcpy(&m->m.list, tmp, sizeof(void*));
+    m->m.count --;
+
+    assert(ptr_is_aligned(tmp));
+
+    return tmp;
+  }
+
   MT_PROTECT(void *, s->lock, _o_objstore_alloc(s));
 }
 
+#else
+
+void *objstore_alloc(object_store_t *s) {
+  MT_PROTECT(void *, s->lock, _o_objstore_alloc(s));
+}
+
+#endif
+
 
 /*
  * Delete all objects
@@ -144,9 +259,15 @@ static void _o_delete_objstore(object_store_t *s) {
   s->bnk = NULL;
   s->free_list = NULL;
   s->free_index = 0;
+#ifdef THREAD_SAFE
+  objstore_clear_magazines(s);
+#endif
 }
 
 void delete_objstore(object_store_t *s) {
+#ifdef THREAD_SAFE
+  unregister_thread_exit_handler(&s->exit_handler);
+#endif
   MT_PROTECT_VOID(s->lock, _o_delete_objstore(s));
 #ifdef THREAD_SAFE
   destroy_yices_lock(&(s->lock));
@@ -167,10 +288,36 @@ static void _o_objstore_free(object_store_t *s, void *object) {
   memcpy(object, &s->free_list, sizeof(void*));
   s->free_list = object;
 }
+
+#ifdef THREAD_SAFE
+
+void objstore_free(object_store_t *s, void *object) {
+  object_magazine_t *m;
+  uint32_t i;
+
+  i = yices_thread_index();
+  if (i < OBJSTORE_MAGAZINES) {
+    m = s->mag + i;
+    memcpy(object, &m->m.list, sizeof(void*));
+    m->m.list = object;
+    m->m.count ++;
+    if (m->m.count >= 2 * OBJSTORE_BATCH) {
+      MT_PROTECT_VOID(s->lock, _o_objstore_flush(s, m));
+    }
+    return;
+  }
+
+  MT_PROTECT_VOID(s->lock, _o_objstore_free(s, object));
+}
+
+#else
+
 void objstore_free(object_store_t *s, void *object) {
   MT_PROTECT_VOID(s->lock, _o_objstore_free(s, object));
 }
 
+#endif
+
 /*
  * Apply finalizer f to all objects then delete s
  */
@@ -195,8 +342,14 @@ static void _o_objstore_delete_finalize(object_store_t *s, void (*f)(void *)) {
   s->bnk = NULL;
   s->free_list = NULL;
   s->free_index = 0;
+#ifdef THREAD_SAFE
+  objstore_clear_magazines(s);
+#endif
 }
 void objstore_delete_finalize(object_store_t *s, void (*f)(void *)) {
+#ifdef THREAD_SAFE
+  unregister_thread_exit_handler(&s->exit_handler);
+#endif
   MT_PROTECT_VOID(s->lock, _o_objstore_delete_finalize(s, f));
 #ifdef THREAD_SAFE
   destroy_yices_lock(&(s->lock));
@@ -224,6 +377,9 @@ static void _o_reset_objstore(object_store_t *s) {
   s->bnk = b;
   s->free_list = NULL;
   s->free_index = 0;
+#ifdef THREAD_SAFE
+  objstore_clear_magazines(s);
+#endif
 }
 void reset_objstore(object_store_t *s) {
   MT_PROTECT_VOID(s->lock, _o_reset_objstore(s));
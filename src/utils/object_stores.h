@@ -49,15 +49,45 @@ struct object_bank_s {
   char block[0]; // real size determined at allocation time
 };
 
+#ifdef THREAD_SAFE
+/*
+ * Magazine = a private free list for one thread
+ * - thread i (as given by yices_thread_index) owns magazine i
+ *   and uses it without locking (if i < OBJSTORE_MAGAZINES)
+ * - objects are moved between a magazine and the shared free list
+ *   by batches of OBJSTORE_BATCH objects
+ * - each magazine is padded to 64 bytes to avoid false sharing
+ * - when thread i exits, its magazine is emptied into the shared free
+ *   list by the store's exit handler, and index i can be reused
+ */
+typedef union object_magazine_u {
+  struct {
+    void *list;
+    uint32_t count;
+  } m;
+  char padding[64];
+} object_magazine_t;
+
+#define OBJSTORE_MAGAZINES 16
+#define OBJSTORE_BATCH 32
+
+#endif
+
 /*
  * Store = a list of blocks
  * - allocations are performed via a free list,
  * - or in the first block of the bank list,
  * - or by adding a new block.
+ * In THREAD_SAFE mode, each thread first allocates from and frees into
+ * its magazine. The lock is taken only to refill or flush a magazine.
+ * The store is registered as a thread-exit handler so it must not be
+ * moved in memory between init and delete.
  */
 typedef struct object_store_s {
 #ifdef THREAD_SAFE
   yices_lock_t lock;   // a lock protecting the object_store
+  yices_thread_exit_handler_t exit_handler;
+  object_magazine_t mag[OBJSTORE_MAGAZINES];
 #endif
   object_bank_t *bnk;  // first block in the bank list
   void *free_list;
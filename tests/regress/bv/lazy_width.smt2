@@ -0,0 +1,47 @@
+(set-logic QF_BV)
+(set-option :yices-bv-lazy-width 8)
+(get-option :yices-bv-lazy-width)
+(declare-fun x () (_ BitVec 16))
+(declare-fun y () (_ BitVec 16))
+(declare-fun z () (_ BitVec 16))
+(declare-fun q () (_ BitVec 16))
+(declare-fun r () (_ BitVec 16))
+(define-fun m () (_ BitVec 16) (bvmul x y))
+(define-fun d () (_ BitVec 16) (bvudiv x (bvor y #x0001)))
+(define-fun e () (_ BitVec 16) (bvurem x (bvor y #x0001)))
+(assert (and (bvule z m) (bvule m z)))
+(assert (and (bvule q d) (bvule d q)))
+(assert (and (bvule r e) (bvule e r)))
+(check-sat)
+(push 1)
+(assert (and (bvult #x0002 x) (bvult x #x0004)))
+(assert (and (bvult #x0004 y) (bvult y #x0006)))
+(assert (not (= z #x000f)))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (and (bvult #x0002 x) (bvult x #x0004)))
+(assert (and (bvult #x0004 y) (bvult y #x0006)))
+(check-sat)
+(get-value (z q r))
+(pop 1)
+(push 1)
+(assert (and (bvult #x0063 x) (bvult x #x0065)))
+(assert (and (bvult #x0006 y) (bvult y #x0008)))
+(assert (or (not (= q #x000e)) (not (= r #x0002))))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (and (bvult #x0063 x) (bvult x #x0065)))
+(assert (and (bvult #x0006 y) (bvult y #x0008)))
+(check-sat)
+(get-value (z q r))
+(pop 1)
+(push 1)
+(assert (= q #x0003))
+(assert (= r #x0001))
+(assert (and (bvult #x0004 y) (bvult y #x0006)))
+(check-sat)
+(get-value (x z))
+(pop 1)
+(check-sat)
@@ -0,0 +1,14 @@
+(set-option :produce-unsat-assumptions true)
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(declare-fun r () Bool)
+(declare-fun s () Bool)
+(assert (= (* x x) 2.0))
+(assert (= r (> (* x x) 1.0)))
+(assert (= s (> x 0.0)))
+(check-sat-assuming ((not r)))
+(get-unsat-assumptions)
+(check-sat-assuming (s))
+(check-sat-assuming ((not s)))
+(check-sat)
+(exit)
@@ -0,0 +1,8 @@
+(set-option :produce-unsat-cores true)
+(set-logic QF_NRA)
+(declare-fun x () Real)
+(assert (= (* x x) 2.0))
+(assert (! (< (* x x) 1.0) :named small))
+(check-sat)
+(get-unsat-core)
+(exit)
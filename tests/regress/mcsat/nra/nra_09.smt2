@@ -0,0 +1,16 @@
+(set-logic QF_NRA)
+(set-info :smt-lib-version 2.0)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+
+;; a point of the unit circle, above the line x = y
+(assert (= (+ (* x x) (* y y)) 1))
+(assert (> x y))
+(assert (> (* x y) 0.25))
+
+;; z = sqrt(x + y)
+(assert (= (* z z) (+ x y)))
+
+(check-sat)
+(exit)
@@ -0,0 +1,13 @@
+(set-logic QF_NRA)
+(set-info :smt-lib-version 2.0)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+
+;; x^2 + y^2 >= 2xy so this is unsat
+(assert (< (+ (* x x) (* y y)) 1))
+(assert (> (* x y) 1))
+(assert (= (* z z) (+ x y)))
+
+(check-sat)
+(exit)
@@ -0,0 +1,180 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST PREPROCESSED SNAPSHOTS:
+ * - yices_assert_formulas_with_snapshot/yices_assert_snapshot
+ *   must give the same results as yices_assert_formulas
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+
+/*
+ * Background formulas: they include substitutions y := x + 3 and a := b + 2
+ */
+#define NBG 5
+
+static term_t bg[NBG];
+static term_t x, y, z, a, b, p;
+
+static void build_background(void) {
+  type_t bv8;
+
+  bv8 = yices_bv_type(8);
+  x = yices_new_uninterpreted_term(bv8);
+  y = yices_new_uninterpreted_term(bv8);
+  z = yices_new_uninterpreted_term(bv8);
+  a = yices_new_uninterpreted_term(yices_int_type());
+  b = yices_new_uninterpreted_term(yices_int_type());
+  p = yices_new_uninterpreted_term(yices_bool_type());
+
+  bg[0] = yices_eq(y, yices_bvadd(x, yices_bvconst_uint32(8, 3)));
+  bg[1] = yices_bvlt_atom(x, yices_bvconst_uint32(8, 100));
+  bg[2] = yices_implies(p, yices_eq(z, yices_bvmul(x, y)));
+  bg[3] = yices_eq(a, yices_add(b, yices_int32(2)));
+  bg[4] = yices_arith_gt_atom(b, yices_int32(0));
+}
+
+
+static void check_code(const char *msg, int32_t code) {
+  if (code < 0) {
+    fprintf(stderr, "%s failed\n", msg);
+    yices_print_error(stderr);
+    exit(1);
+  }
+}
+
+static void check_error(const char *msg, int32_t code, error_code_t expected) {
+  if (code >= 0 || yices_error_code() != expected) {
+    fprintf(stderr, "%s: expected error %"PRId32"\n", msg, (int32_t) expected);
+    exit(1);
+  }
+}
+
+
+/*
+ * Query i: background + two facts on z and p
+ * - check that the snapshot and direct assertion agree
+ */
+static void test_query(ctx_config_t *config, context_t *src, uint32_t i) {
+  context_t *c1, *c2;
+  model_t *mdl;
+  term_t f[2];
+  smt_status_t s1, s2;
+
+  f[0] = yices_eq(z, yices_bvconst_uint32(8, i));
+  f[1] = (i & 1) ? p : yices_not(p);
+
+  c1 = yices_new_context(config);
+  check_code("assert_snapshot", yices_assert_snapshot(c1, src));
+  check_code("assert_formulas", yices_assert_formulas(c1, 2, f));
+  s1 = yices_check_context(c1, NULL);
+
+  c2 = yices_new_context(config);
+  check_code("assert_formulas", yices_assert_formulas(c2, NBG, bg));
+  check_code("assert_formulas", yices_assert_formulas(c2, 2, f));
+  s2 = yices_check_context(c2, NULL);
+
+  printf("query %"PRIu32": %s\n", i, s1 == STATUS_SAT ? "sat" : s1 == STATUS_UNSAT ? "unsat" : "other");
+  if (s1 != s2) {
+    fprintf(stderr, "BUG: snapshot and direct assertions disagree\n");
+    exit(1);
+  }
+
+  if (s1 == STATUS_SAT) {
+    mdl = yices_get_model(c1, true);
+    if (yices_formulas_true_in_model(mdl, NBG, bg) != 1 ||
+        yices_formulas_true_in_model(mdl, 2, f) != 1) {
+      fprintf(stderr, "BUG: invalid model\n");
+      exit(1);
+    }
+    yices_free_model(mdl);
+  }
+
+  yices_free_context(c1);
+  yices_free_context(c2);
+}
+
+
+int main(void) {
+  ctx_config_t *config;
+  context_t *src, *ctx;
+  term_t t;
+  uint32_t i;
+
+  yices_init();
+  build_background();
+
+  config = yices_new_config();
+  yices_set_config(config, "mode", "one-shot");
+
+  src = yices_new_context(config);
+  check_code("assert_formulas_with_snapshot", yices_assert_formulas_with_snapshot(src, NBG, bg));
+  if (yices_check_context(src, NULL) != STATUS_SAT) {
+    fprintf(stderr, "BUG: background should be sat\n");
+    exit(1);
+  }
+
+  // the snapshot must survive garbage collection
+  yices_garbage_collect(NULL, 0, NULL, 0, true);
+
+  for (i=0; i<20; i++) {
+    test_query(config, src, i);
+  }
+
+  // the target context must be fresh
+  ctx = yices_new_context(config);
+  check_code("assert_formula", yices_assert_formula(ctx, p));
+  check_error("assert_snapshot", yices_assert_snapshot(ctx, src), CTX_INVALID_OPERATION);
+  check_error("assert_formulas_with_snapshot", yices_assert_formulas_with_snapshot(ctx, NBG, bg), CTX_INVALID_OPERATION);
+
+  // ctx has no snapshot
+  yices_reset_context(ctx);
+  check_error("assert_snapshot", yices_assert_snapshot(ctx, ctx), CTX_INVALID_OPERATION);
+  yices_free_context(ctx);
+
+  // different configuration
+  ctx = yices_new_context(NULL);
+  check_error("assert_snapshot", yices_assert_snapshot(ctx, src), CTX_INVALID_OPERATION);
+  yices_free_context(ctx);
+  yices_free_context(src);
+
+  // snapshot of unsat formulas
+  t = yices_and2(bg[1], yices_bvge_atom(x, yices_bvconst_uint32(8, 200)));
+  src = yices_new_context(config);
+  check_code("assert_formulas_with_snapshot", yices_assert_formulas_with_snapshot(src, 1, &t));
+  ctx = yices_new_context(config);
+  check_code("assert_snapshot", yices_assert_snapshot(ctx, src));
+  if (yices_check_context(src, NULL) != STATUS_UNSAT || yices_check_context(ctx, NULL) != STATUS_UNSAT) {
+    fprintf(stderr, "BUG: expected unsat\n");
+    exit(1);
+  }
+  yices_free_context(ctx);
+  yices_free_context(src);
+
+  yices_free_config(config);
+  yices_exit();
+
+  return 0;
+}
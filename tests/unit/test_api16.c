@@ -0,0 +1,206 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE QUERY CACHE:
+ * - yices_check_formulas must give the same results with and without cache
+ * - models taken from the cache must satisfy the query
+ * - adding a key that's already in the cache must not create a second
+ *   entry (two threads can both miss on the same query and add it)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "api/query_cache.h"
+#include "yices.h"
+
+
+static term_t x, y, p;
+
+static void build_terms(void) {
+  x = yices_new_uninterpreted_term(yices_int_type());
+  y = yices_new_uninterpreted_term(yices_int_type());
+  p = yices_new_uninterpreted_term(yices_bool_type());
+}
+
+
+/*
+ * Query i: x + y = i, x > y, and p or x < 0
+ * - query 5 + x < 0 is unsat
+ */
+static uint32_t make_query(uint32_t i, term_t *f) {
+  f[0] = yices_arith_eq_atom(yices_add(x, y), yices_int32(i));
+  f[1] = yices_arith_gt_atom(x, y);
+  f[2] = yices_or2(p, yices_arith_lt0_atom(x));
+  if (i == 5) {
+    f[3] = yices_arith_lt0_atom(x);
+    f[4] = yices_not(p);
+    return 5;
+  }
+  return 3;
+}
+
+static void check_query(uint32_t i, bool reverse) {
+  term_t f[5], g[6];
+  model_t *mdl;
+  smt_status_t stat;
+  uint32_t j, n;
+
+  n = make_query(i, f);
+  for (j=0; j<n; j++) {
+    g[j] = reverse ? f[n - 1 - j] : f[j];
+  }
+  g[n] = g[0]; // duplicate
+
+  mdl = NULL;
+  stat = yices_check_formulas(g, n+1, "QF_LIA", &mdl);
+  if (i == 5) {
+    if (stat != STATUS_UNSAT || mdl != NULL) {
+      fprintf(stderr, "BUG: query %"PRIu32" should be unsat\n", i);
+      exit(1);
+    }
+  } else {
+    if (stat != STATUS_SAT || mdl == NULL) {
+      fprintf(stderr, "BUG: query %"PRIu32" should be sat\n", i);
+      exit(1);
+    }
+    if (yices_formulas_true_in_model(mdl, n, f) != 1) {
+      fprintf(stderr, "BUG: invalid model for query %"PRIu32"\n", i);
+      exit(1);
+    }
+    yices_free_model(mdl);
+  }
+}
+
+static void get_stats(uint64_t *hits, uint64_t *misses, uint32_t *entries) {
+  uint64_t nbytes;
+
+  yices_get_query_cache_stats(hits, misses, entries, &nbytes);
+  printf("hits = %"PRIu64", misses = %"PRIu64", entries = %"PRIu32", bytes = %"PRIu64"\n",
+         *hits, *misses, *entries, nbytes);
+}
+
+/*
+ * Add the same UNSAT entry twice in a local cache
+ * - the key must be sorted: x, y, p are created in that order
+ */
+static void test_duplicate_add(void) {
+  query_cache_t cache;
+  term_t f[3];
+  uint32_t n;
+
+  f[0] = x;
+  f[1] = y;
+  f[2] = p;
+  n = 3;
+  init_query_cache(&cache);
+  query_cache_set_limit(&cache, 1000000);
+  query_cache_add(&cache, 0, f, n, STATUS_UNSAT, NULL, NULL, 0);
+  query_cache_add(&cache, 0, f, n, STATUS_UNSAT, NULL, NULL, 0);
+  if (cache.nelems != 1 || query_cache_find(&cache, 0, f, n) == NULL) {
+    fprintf(stderr, "BUG: duplicate entries in the cache\n");
+    exit(1);
+  }
+  delete_query_cache(&cache);
+}
+
+
+int main(void) {
+  uint64_t hits, misses;
+  uint32_t i, entries;
+  term_t f[5];
+
+  yices_init();
+  build_terms();
+  test_duplicate_add();
+
+  // no cache
+  for (i=0; i<10; i++) {
+    check_query(i, false);
+  }
+  get_stats(&hits, &misses, &entries);
+  if (hits != 0 || misses != 0 || entries != 0) {
+    fprintf(stderr, "BUG: the cache should be disabled\n");
+    exit(1);
+  }
+
+  // with cache
+  yices_set_query_cache_size(1000000);
+  for (i=0; i<10; i++) {
+    check_query(i, false);
+  }
+  yices_garbage_collect(NULL, 0, NULL, 0, false);
+  for (i=0; i<10; i++) {
+    check_query(i, true);
+  }
+  get_stats(&hits, &misses, &entries);
+  if (hits != 10 || misses != 10 || entries != 10) {
+    fprintf(stderr, "BUG: unexpected cache statistics\n");
+    exit(1);
+  }
+
+  // a different logic is a different query
+  make_query(0, f);
+  if (yices_check_formulas(f, 3, NULL, NULL) != STATUS_SAT) {
+    fprintf(stderr, "BUG: query 0 should be sat\n");
+    exit(1);
+  }
+  get_stats(&hits, &misses, &entries);
+  if (misses != 11 || entries != 11) {
+    fprintf(stderr, "BUG: unexpected cache statistics\n");
+    exit(1);
+  }
+
+  // small cache: at most a few entries
+  yices_set_query_cache_size(700);
+  for (i=0; i<10; i++) {
+    check_query(i, false);
+  }
+  get_stats(&hits, &misses, &entries);
+  if (entries == 0 || entries >= 10) {
+    fprintf(stderr, "BUG: the cache should be bounded\n");
+    exit(1);
+  }
+
+  // errors
+  if (yices_check_formulas(f, 3, "QF_FOO", NULL) != STATUS_ERROR ||
+      yices_error_code() != CTX_UNKNOWN_LOGIC) {
+    fprintf(stderr, "BUG: expected CTX_UNKNOWN_LOGIC\n");
+    exit(1);
+  }
+  f[0] = x;
+  if (yices_check_formulas(f, 3, "QF_LIA", NULL) != STATUS_ERROR ||
+      yices_error_code() != TYPE_MISMATCH) {
+    fprintf(stderr, "BUG: expected TYPE_MISMATCH\n");
+    exit(1);
+  }
+
+  yices_set_query_cache_size(0);
+  get_stats(&hits, &misses, &entries);
+  if (entries != 0) {
+    fprintf(stderr, "BUG: the cache should be empty\n");
+    exit(1);
+  }
+
+  yices_exit();
+
+  return 0;
+}
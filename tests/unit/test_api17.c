@@ -0,0 +1,213 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST MINOR GARBAGE COLLECTION:
+ * - yices_garbage_collect_young must delete the young garbage
+ *   and keep all roots, old terms, and their subterms
+ * - contexts and models used since the last collection must be
+ *   scanned (including the model's evaluation cache)
+ * - a young generation that's too large falls back to a full collection
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+
+static bool is_live(term_t t) {
+  return yices_type_of_term(t) != NULL_TYPE;
+}
+
+static void check_live(const char *name, term_t t, bool expected) {
+  if (is_live(t) != expected) {
+    fprintf(stderr, "BUG: term %s should be %s\n", name, expected ? "live" : "dead");
+    exit(1);
+  }
+}
+
+static int32_t int_value(model_t *mdl, term_t t) {
+  int32_t v;
+
+  if (yices_get_int32_value(mdl, t, &v) < 0) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  return v;
+}
+
+static term_t int_var(const char *name) {
+  term_t x;
+
+  x = yices_new_uninterpreted_term(yices_int_type());
+  if (name != NULL) {
+    yices_set_term_name(x, name);
+  }
+  return x;
+}
+
+int main(void) {
+  context_t *ctx, *ctx2;
+  model_t *mdl;
+  term_t x, y, z, u, old, g, w, r, k, c, zz, v, a, b, val, eleven;
+  uint32_t i, n;
+
+  yices_init();
+
+  x = int_var("x");
+  y = int_var("y");
+  old = yices_add(yices_mul(x, y), yices_int32(1));
+
+  // full collection: old survives
+  yices_garbage_collect(&old, 1, NULL, 0, true);
+  check_live("old", old, true);
+
+  ctx = yices_new_context(NULL);
+
+  // young terms
+  u = int_var(NULL);                                                    // garbage
+  g = yices_add(yices_mul(yices_mul(x, x), y), yices_int32(3));         // garbage
+  w = yices_add(old, u);                                                // garbage
+  r = yices_add(x, yices_mul(yices_int32(2), y));                       // root via t[]
+  k = yices_arith_gt0_atom(yices_sub(x, y));                            // root via incref
+  c = yices_arith_lt_atom(x, yices_add(y, yices_int32(7)));             // asserted
+  z = int_var("z");                                                     // named
+  zz = yices_add(z, yices_int32(1));                                    // garbage
+
+  yices_incref_term(k);
+  yices_assert_formula(ctx, c);
+
+  n = yices_num_terms();
+  yices_garbage_collect_young(&r, 1);
+  printf("terms: %"PRIu32" before, %"PRIu32" after\n", n, yices_num_terms());
+
+  check_live("u", u, false);
+  check_live("g", g, false);
+  check_live("w", w, false);
+  check_live("zz", zz, false);
+  check_live("old", old, true);
+  check_live("r", r, true);
+  check_live("k", k, true);
+  check_live("c", c, true);
+  check_live("z", z, true);
+  if (yices_get_term_by_name("z") != z) {
+    fprintf(stderr, "BUG: lost name z\n");
+    exit(1);
+  }
+
+  // the context must still work
+  yices_assert_formula(ctx, k);
+  if (yices_check_context(ctx, NULL) != STATUS_SAT) {
+    fprintf(stderr, "BUG: context should be sat\n");
+    exit(1);
+  }
+
+  // rebuilding the dead terms must work (hash consing and power products)
+  g = yices_add(yices_mul(yices_mul(x, x), y), yices_int32(3));
+  check_live("g", g, true);
+  if (yices_term_num_children(g) != 2) {
+    fprintf(stderr, "BUG: bad term g\n");
+    exit(1);
+  }
+
+  // the young generation was promoted: nothing more to delete
+  yices_garbage_collect_young(NULL, 0);
+  check_live("r", r, true);
+  check_live("g", g, false);
+
+  // short-lived terms: the table does not grow
+  n = yices_num_terms();
+  for (i=0; i<10; i++) {
+    v = yices_add(yices_mul(x, yices_int32(i + 10)), yices_mul(z, z));
+    check_live("v", v, true);
+    yices_garbage_collect_young(NULL, 0);
+    check_live("v", v, false);
+  }
+  if (yices_num_terms() != n) {
+    fprintf(stderr, "BUG: %"PRIu32" terms, expected %"PRIu32"\n", yices_num_terms(), n);
+    exit(1);
+  }
+
+  // a context used after the last collection is scanned
+  ctx2 = yices_new_context(NULL);
+  yices_garbage_collect_young(NULL, 0);
+  a = yices_arith_gt_atom(yices_mul(y, y), yices_add(x, yices_int32(5)));
+  yices_assert_formula(ctx2, a);
+  yices_garbage_collect_young(NULL, 0);
+  check_live("a", a, true);
+  if (yices_check_context(ctx2, NULL) != STATUS_SAT) {
+    fprintf(stderr, "BUG: context 2 should be sat\n");
+    exit(1);
+  }
+
+  // same thing for models and their evaluation cache
+  b = int_var(NULL);
+  val = yices_int32(3);
+  mdl = yices_model_from_map(1, &b, &val);
+  yices_garbage_collect_young(NULL, 0);
+  check_live("b", b, true);
+  v = yices_mul(b, yices_int32(7));
+  if (int_value(mdl, v) != 21) {
+    fprintf(stderr, "BUG: wrong value for b * 7\n");
+    exit(1);
+  }
+  eleven = yices_int32(11);
+  yices_garbage_collect_young(&eleven, 1);
+  check_live("v", v, false);
+  // v's index is reused: the cached value must be gone
+  v = yices_mul(b, eleven);
+  if (int_value(mdl, v) != 33) {
+    fprintf(stderr, "BUG: wrong value for b * 11\n");
+    exit(1);
+  }
+  yices_free_model(mdl);
+
+  // a large young generation: this is a full collection
+  n = yices_num_terms();
+  for (i=0; i<2*n + 2000; i++) {
+    v = yices_add(x, yices_int32(i + 1000));
+  }
+  yices_garbage_collect_young(NULL, 0);
+  check_live("v", v, false);
+  check_live("a", a, true);
+  check_live("z", z, true);
+  if (yices_num_terms() > n + 10) {
+    fprintf(stderr, "BUG: %"PRIu32" terms after collection, expected about %"PRIu32"\n", yices_num_terms(), n);
+    exit(1);
+  }
+  // the young generation is tracked again
+  v = yices_add(x, yices_int32(-7));
+  yices_garbage_collect_young(NULL, 0);
+  check_live("v", v, false);
+  check_live("a", a, true);
+
+  yices_free_context(ctx2);
+
+  // a full collection with keep_named = false still works
+  yices_decref_term(k);
+  yices_garbage_collect(NULL, 0, NULL, 0, false);
+  check_live("c", c, true);
+
+  yices_free_context(ctx);
+  yices_exit();
+
+  return 0;
+}
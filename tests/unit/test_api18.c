@@ -0,0 +1,75 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST GARBAGE COLLECTION WITH keep_named = false
+ * - names of dead terms must be removed from the symbol table
+ * - names of live terms must be kept
+ *
+ * This used to loop forever as soon as a live term had a name.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+
+#define NTERMS 200
+
+int main(void) {
+  term_t x[NTERMS];
+  char name[20];
+  uint32_t i;
+  term_t t;
+
+  yices_init();
+
+  for (i=0; i<NTERMS; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_int_type());
+    snprintf(name, sizeof(name), "x%"PRIu32, i);
+    yices_set_term_name(x[i], name);
+  }
+
+  // keep the even terms: names of live and dead terms are
+  // mixed in the same hash buckets
+  for (i=0; i<NTERMS; i += 2) {
+    yices_incref_term(x[i]);
+  }
+  yices_garbage_collect(NULL, 0, NULL, 0, false);
+
+  for (i=0; i<NTERMS; i++) {
+    snprintf(name, sizeof(name), "x%"PRIu32, i);
+    t = yices_get_term_by_name(name);
+    if (i % 2 == 0 && t != x[i]) {
+      fprintf(stderr, "BUG: lost the name of live term x%"PRIu32"\n", i);
+      exit(1);
+    }
+    if (i % 2 == 1 && t != NULL_TERM) {
+      fprintf(stderr, "BUG: kept the name of dead term x%"PRIu32"\n", i);
+      exit(1);
+    }
+  }
+  printf("%"PRIu32" names kept\n", (uint32_t) (NTERMS/2));
+
+  yices_exit();
+
+  return 0;
+}
@@ -77,12 +77,16 @@ static void show_params(param_t *params) {
   printf("--- egraph ---\n");
   printf("  use_dyn_ack            = %s\n", bool2string(params->use_dyn_ack));
   printf("  use_bool_dyn_ack       = %s\n", bool2string(params->use_bool_dyn_ack));
+  printf("  use_expl_cache         = %s\n", bool2string(params->use_expl_cache));
   printf("  max_ackermann          = %"PRIu32"\n", params->max_ackermann);
   printf("  max_boolackermann      = %"PRIu32"\n", params->max_boolackermann);
   printf("  aux_eq_quota           = %"PRIu32"\n", params->aux_eq_quota);
   printf("  aux_eq_ratio           = %.4f\n", params->aux_eq_ratio);
   printf("  dyn_ack_threshold      = %"PRIu32"\n", (uint32_t) params->dyn_ack_threshold);
   printf("  dyn_bool_ack_threshold = %"PRIu32"\n", (uint32_t) params->dyn_bool_ack_threshold);
+  printf("  dyn_ack_budget         = %"PRIu32"\n", params->dyn_ack_budget);
+  printf("  dyn_ack_budget_period  = %"PRIu32"\n", params->dyn_ack_budget_period);
+  printf("  dyn_ack_decay_period   = %"PRIu32"\n", params->dyn_ack_decay_period);
   printf("  max_interface_eqs      = %"PRIu32"\n", params->max_interface_eqs);
   printf("--- simplex ---\n");
   printf("  use_simplex_prop       = %s\n", bool2string(params->use_simplex_prop));
@@ -94,6 +98,8 @@ static void show_params(param_t *params) {
   printf("--- array solver ---\n");
   printf("  max_update_conflicts   = %"PRIu32"\n", params->max_update_conflicts);
   printf("  max_extensionality     = %"PRIu32"\n", params->max_extensionality);
+  printf("--- bitvector solver ---\n");
+  printf("  bv_lazy_width          = %"PRIu32"\n", params->bv_lazy_width);
   printf("\n");
   fflush(stdout);
 }
@@ -255,6 +261,7 @@ static void test_set_branching(param_t *params, const char *name) {
  * Tests of set_param
  */
 static void test_set_params(param_t *params) {
+  test_set_bool_param(params, "cache-explanations");
   test_set_bool_param(params, "cache-tclauses");
   test_set_bool_param(params, "dyn-ack");
   test_set_bool_param(params, "dyn-bool-ack");
@@ -278,12 +285,20 @@ static void test_set_params(param_t *params) {
   test_set_posint2_param(params, "tclause-size");
 
   test_set_nonnegint_param(params, "prop-threshold");
+  test_set_nonnegint_param(params, "dyn-ack-budget");
+  test_set_nonnegint_param(params, "dyn-ack-budget-period");
+  test_set_nonnegint_param(params, "dyn-ack-decay-period");
 
   test_set_posint16_param(params, "dyn-ack-threshold");
   test_set_posint16_param(params, "dyn-bool-ack-threshold");
 
   test_set_uint32_pram(params, "random-seed");
 
+  test_set_param(params, "bv-lazy-width", "0", 0, 0);
+  test_set_param(params, "bv-lazy-width", "64", 0, 0);
+  test_set_param(params, "bv-lazy-width", "65", -1, CTX_INVALID_PARAMETER_VALUE);
+  test_set_param(params, "bv-lazy-width", "-1", -1, CTX_INVALID_PARAMETER_VALUE);
+
   test_set_branching(params, "branching");
 
   test_set_param(params, "xxxx", "yyyy", -1, CTX_UNKNOWN_PARAMETER);
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST INTERNALIZATION OF DEEP TERMS
+ *
+ * We build chains of depth DEPTH and assert them in a fresh context.
+ * Internalization must not overflow the C stack. The chains are:
+ * - arithmetic if-then-else: x_{i+1} = (ite b_i (+ x_i a_i) c_i)
+ * - nested or: o_{i+1} = (or b_i (and o_i c_i))
+ * - nested function applications: (f (f ... (f a)))
+ * - bit-vector if-then-else and sums
+ */
+
+/*
+ * Force assert to work even if compiled with debug disabled
+ */
+#ifdef NDEBUG
+# undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+
+#define DEPTH 100000
+
+
+static term_t new_bool_var(void) {
+  return yices_new_uninterpreted_term(yices_bool_type());
+}
+
+
+/*
+ * Assert a1 and a2 in a new context for logic
+ * - if check is true, also check that (and a1 a2) is sat
+ */
+static void test_assertions(const char *name, const char *logic, term_t a1, term_t a2, bool check) {
+  ctx_config_t *config;
+  context_t *ctx;
+  smt_status_t stat;
+
+  config = yices_new_config();
+  if (yices_default_config_for_logic(config, logic) < 0) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+
+  if (yices_assert_formula(ctx, a1) < 0 || yices_assert_formula(ctx, a2) < 0) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  if (check) {
+    stat = yices_check_context(ctx, NULL);
+    if (stat != STATUS_SAT) {
+      fprintf(stderr, "BUG: %s: unexpected status %"PRId32"\n", name, (int32_t) stat);
+      exit(1);
+    }
+    printf("%s: sat\n", name);
+  } else {
+    printf("%s: internalized\n", name);
+  }
+  fflush(stdout);
+
+  yices_free_context(ctx);
+}
+
+
+static term_t new_int_var(void) {
+  return yices_new_uninterpreted_term(yices_int_type());
+}
+
+/*
+ * x_0 = 0, x_{i+1} = (ite b_i (+ x_i a_i) c_i)
+ * assert y = x_DEPTH and y < 0
+ * - we don't call check: simplex is slow on this problem
+ */
+static void test_arith_ite(void) {
+  term_t x, y;
+  uint32_t i;
+
+  x = yices_zero();
+  for (i=0; i<DEPTH; i++) {
+    x = yices_ite(new_bool_var(), yices_add(x, new_int_var()), new_int_var());
+  }
+  y = new_int_var();
+  test_assertions("arith ite", "QF_LIA", yices_arith_eq_atom(y, x), yices_arith_lt0_atom(y), false);
+}
+
+
+/*
+ * o_0 = b, o_{i+1} = (or b_i (and o_i c_i))
+ */
+static void test_or(void) {
+  term_t o;
+  uint32_t i;
+
+  o = new_bool_var();
+  for (i=0; i<DEPTH; i++) {
+    o = yices_or2(new_bool_var(), yices_and2(o, new_bool_var()));
+  }
+  test_assertions("or", "NONE", o, yices_true(), true);
+}
+
+
+/*
+ * (f (f ... (f a))) = a
+ */
+static void test_apply(void) {
+  type_t tau;
+  term_t f, a, t;
+  uint32_t i;
+
+  tau = yices_new_uninterpreted_type();
+  f = yices_new_uninterpreted_term(yices_function_type1(tau, tau));
+  a = yices_new_uninterpreted_term(tau);
+  t = a;
+  for (i=0; i<DEPTH; i++) {
+    t = yices_application1(f, t);
+  }
+  test_assertions("apply", "QF_UF", yices_eq(t, a), yices_neq(t, yices_application1(f, a)), true);
+}
+
+
+/*
+ * z_0 = 0, z_{i+1} = (ite b_i z_i (bvadd z_i 1))
+ */
+static void test_bv(void) {
+  term_t z, y;
+  uint32_t i;
+
+  z = yices_bvconst_zero(8);
+  for (i=0; i<DEPTH; i++) {
+    z = yices_ite(new_bool_var(), z, yices_bvadd(z, yices_bvconst_one(8)));
+  }
+  y = yices_new_uninterpreted_term(yices_bv_type(8));
+  test_assertions("bv ite", "QF_BV", yices_eq(y, z), yices_true(), true);
+}
+
+
+int main(void) {
+  yices_init();
+
+  test_arith_ite();
+  test_or();
+  test_apply();
+  test_bv();
+
+  yices_exit();
+
+  return 0;
+}
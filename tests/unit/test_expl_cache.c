@@ -0,0 +1,268 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE CACHE OF THEORY EXPLANATIONS IN THE EGRAPH
+ *
+ * We run the same random sequence of push/assert/check/pop on two
+ * QF_UFLIA contexts: one with parameter cache-explanations enabled and
+ * one without. The results must agree. After each operation, we also
+ * check that the cache has no entry for an edge that was removed by
+ * backtracking, and no entry tagged with a level above the current
+ * decision level.
+ */
+
+/*
+ * Force assert to work even if compiled with debug disabled
+ */
+#ifdef NDEBUG
+# undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "context/context_types.h"
+#include "solvers/egraph/egraph_types.h"
+
+#include "yices.h"
+
+
+#ifdef MINGW
+static inline long int random(void) {
+  return rand();
+}
+
+static inline void srandom(unsigned int seed) {
+  srand(seed);
+}
+#endif
+
+
+#define NVARS 16
+#define MAX_DEPTH 20
+#define NROUNDS 3000
+#define NASSERTS 4
+
+static term_t x[NVARS];
+static term_t fx[NVARS];
+
+
+/*
+ * Random integer constant in [-1, 1]
+ */
+static term_t random_offset(void) {
+  return yices_int32((int32_t) (random() % 3) - 1);
+}
+
+static term_t random_var(void) {
+  return x[random() % NVARS];
+}
+
+static term_t random_app(void) {
+  return fx[random() % NVARS];
+}
+
+/*
+ * Random atom:
+ * - x_i - x_j <= c
+ * - x_i = x_j + c
+ * - f(x_i) = x_j + c
+ * - f(x_i) /= f(x_j)
+ * - x_i /= x_j
+ */
+static term_t random_atom(void) {
+  switch (random() % 5) {
+  case 0:
+    return yices_arith_leq_atom(yices_sub(random_var(), random_var()), random_offset());
+  case 1:
+    return yices_arith_eq_atom(random_var(), yices_add(random_var(), random_offset()));
+  case 2:
+    return yices_arith_eq_atom(random_app(), yices_add(random_var(), random_offset()));
+  case 3:
+    return yices_neq(random_app(), random_app());
+  default:
+    return yices_neq(random_var(), random_var());
+  }
+}
+
+static term_t random_assertion(void) {
+  if (random() % 2 == 0) {
+    return yices_or3(random_atom(), random_atom(), random_atom());
+  }
+  return random_atom();
+}
+
+
+/*
+ * Check that the cache contains only entries for existing edges,
+ * created at a level no higher than the current decision level.
+ */
+static void check_cache(context_t *ctx) {
+  egraph_t *egraph;
+  ivector_t *trail;
+  uint32_t i, n;
+  int32_t k;
+
+  egraph = ctx->egraph;
+  assert(egraph != NULL);
+
+  for (i=0; i<egraph->expl_cache_size; i++) {
+    if (egraph->expl_cache[i] != NULL && i >= egraph->stack.top) {
+      fprintf(stderr, "BUG: stale cache entry for edge %"PRIu32" (stack top = %"PRIu32")\n", i, egraph->stack.top);
+      exit(1);
+    }
+  }
+
+  trail = &egraph->expl_cache_trail;
+  n = trail->size;
+  assert((n & 1) == 0);
+  for (i=0; i<n; i += 2) {
+    k = trail->data[i];
+    if ((uint32_t) trail->data[i+1] > egraph->decision_level ||
+        k < 0 || (uint32_t) k >= egraph->expl_cache_size || egraph->expl_cache[k] == NULL) {
+      fprintf(stderr, "BUG: bad trail entry <%"PRId32", %"PRId32">\n", k, trail->data[i+1]);
+      exit(1);
+    }
+  }
+}
+
+
+static context_t *new_uflia_context(void) {
+  ctx_config_t *config;
+  context_t *ctx;
+
+  config = yices_new_config();
+  if (yices_default_config_for_logic(config, "QF_UFLIA") < 0 ||
+      yices_set_config(config, "mode", "push-pop") < 0) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  ctx = yices_new_context(config);
+  yices_free_config(config);
+  if (ctx == NULL) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  assert(ctx->egraph != NULL);
+
+  return ctx;
+}
+
+
+static smt_status_t check(context_t *ctx, param_t *params) {
+  smt_status_t stat;
+
+  stat = yices_check_context(ctx, params);
+  if (stat == STATUS_ERROR) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  return stat;
+}
+
+
+int main(void) {
+  param_t *p1, *p2;
+  context_t *c1, *c2;
+  type_t int_type, fun_type;
+  term_t f, a;
+  smt_status_t s1, s2;
+  uint32_t i, j, depth, nsat, nunsat;
+  char name[20];
+
+  yices_init();
+  srandom(1783);
+
+  int_type = yices_int_type();
+  fun_type = yices_function_type1(int_type, int_type);
+  f = yices_new_uninterpreted_term(fun_type);
+  yices_set_term_name(f, "f");
+  for (i=0; i<NVARS; i++) {
+    x[i] = yices_new_uninterpreted_term(int_type);
+    snprintf(name, sizeof(name), "x%"PRIu32, i);
+    yices_set_term_name(x[i], name);
+    fx[i] = yices_application1(f, x[i]);
+  }
+
+  c1 = new_uflia_context();
+  c2 = new_uflia_context();
+
+  p1 = yices_new_param_record();
+  yices_default_params_for_context(c1, p1);
+  if (yices_set_param(p1, "cache-explanations", "true") < 0) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+  p2 = yices_new_param_record();
+  yices_default_params_for_context(c2, p2);
+  yices_set_param(p2, "cache-explanations", "false");
+
+  depth = 0;
+  nsat = 0;
+  nunsat = 0;
+  for (i=0; i<NROUNDS; i++) {
+    if (depth == MAX_DEPTH || (depth > 0 && (yices_context_status(c1) == STATUS_UNSAT || random() % 3 == 0))) {
+      yices_pop(c1);
+      yices_pop(c2);
+      depth --;
+      check_cache(c1);
+      continue;
+    }
+
+    yices_push(c1);
+    yices_push(c2);
+    depth ++;
+    for (j=0; j<NASSERTS; j++) {
+      a = random_assertion();
+      yices_assert_formula(c1, a);
+      yices_assert_formula(c2, a);
+    }
+
+    s1 = check(c1, p1);
+    s2 = check(c2, p2);
+    if (s1 != s2) {
+      fprintf(stderr, "BUG: round %"PRIu32": status %"PRId32" with the cache, %"PRId32" without\n",
+              i, (int32_t) s1, (int32_t) s2);
+      exit(1);
+    }
+    check_cache(c1);
+    if (s1 == STATUS_SAT) {
+      nsat ++;
+    } else {
+      nunsat ++;
+    }
+  }
+
+  assert(c2->egraph->stats.th_expl_hits == 0);
+
+  printf("%"PRIu32" checks: %"PRIu32" sat, %"PRIu32" unsat\n", nsat + nunsat, nsat, nunsat);
+  printf("cached th. explanations : %"PRIu32"\n", c1->egraph->stats.th_expl_hits);
+  printf("built th. explanations  : %"PRIu32"\n", c1->egraph->stats.th_expl_misses);
+  fflush(stdout);
+
+  yices_free_param_record(p1);
+  yices_free_param_record(p2);
+  yices_free_context(c1);
+  yices_free_context(c2);
+  yices_exit();
+
+  return 0;
+}
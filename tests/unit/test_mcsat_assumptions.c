@@ -0,0 +1,186 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST CHECK WITH ASSUMPTIONS AND UNSAT CORES IN MCSAT
+ *
+ * We assert x^2 = 2 in a QF_NRA context then run a sequence of checks
+ * with different assumptions on the same context:
+ * - the status must be as expected
+ * - an unsat core must be a subset of the assumptions, and it must be
+ *   unsat (checked by using the core as assumptions)
+ * - after an unsat check, the context must be usable again
+ */
+
+/*
+ * Force assert to work even if compiled with debug disabled
+ */
+#ifdef NDEBUG
+# undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "yices.h"
+
+#if HAVE_MCSAT
+
+static void print_error(void) {
+  yices_print_error(stderr);
+  exit(1);
+}
+
+static term_t parse(const char *s) {
+  term_t t;
+
+  t = yices_parse_term(s);
+  if (t < 0) print_error();
+  return t;
+}
+
+static context_t *make_context(void) {
+  ctx_config_t *cfg;
+  context_t *ctx;
+
+  cfg = yices_new_config();
+  if (yices_default_config_for_logic(cfg, "QF_NRA") < 0 ||
+      yices_set_config(cfg, "mode", "push-pop") < 0) {
+    print_error();
+  }
+  ctx = yices_new_context(cfg);
+  if (ctx == NULL) print_error();
+  yices_free_config(cfg);
+
+  return ctx;
+}
+
+static bool in_array(term_t t, const term_t *a, uint32_t n) {
+  uint32_t i;
+
+  for (i=0; i<n; i++) {
+    if (a[i] == t) return true;
+  }
+  return false;
+}
+
+
+/*
+ * Check with assumptions a[0 ... n-1]: the expected status is expected.
+ * If the result is unsat, check the core.
+ */
+static void check(context_t *ctx, const term_t *a, uint32_t n, smt_status_t expected) {
+  term_vector_t core;
+  smt_status_t stat;
+  uint32_t i;
+
+  stat = yices_check_context_with_assumptions(ctx, NULL, n, a);
+  if (stat == STATUS_ERROR) print_error();
+  if (stat != expected) {
+    fprintf(stderr, "BUG: status %"PRId32", expected %"PRId32"\n", (int32_t) stat, (int32_t) expected);
+    exit(1);
+  }
+  printf("%"PRIu32" assumptions: %s", n, stat == STATUS_SAT ? "sat" : "unsat");
+
+  if (stat == STATUS_UNSAT) {
+    yices_init_term_vector(&core);
+    if (yices_get_unsat_core(ctx, &core) < 0) print_error();
+    printf(", core size = %"PRIu32, core.size);
+    if (core.size == 0 || core.size > n) {
+      fprintf(stderr, "\nBUG: bad core size\n");
+      exit(1);
+    }
+    for (i=0; i<core.size; i++) {
+      if (! in_array(core.data[i], a, n)) {
+        fprintf(stderr, "\nBUG: the core is not a subset of the assumptions\n");
+        exit(1);
+      }
+    }
+    stat = yices_check_context_with_assumptions(ctx, NULL, core.size, core.data);
+    if (stat != STATUS_UNSAT) {
+      fprintf(stderr, "\nBUG: the core is not unsat\n");
+      exit(1);
+    }
+    yices_delete_term_vector(&core);
+  }
+  printf("\n");
+  fflush(stdout);
+}
+
+
+int main(void) {
+  context_t *ctx;
+  term_t x, y, a[4];
+
+  yices_init();
+
+  x = yices_new_uninterpreted_term(yices_real_type());
+  yices_set_term_name(x, "x");
+  y = yices_new_uninterpreted_term(yices_real_type());
+  yices_set_term_name(y, "y");
+
+  ctx = make_context();
+  if (yices_assert_formula(ctx, parse("(= (* x x) 2)")) < 0) print_error();
+
+  // x > 0 and x < 1: unsat
+  a[0] = parse("(> x 0)");
+  a[1] = parse("(< x 1)");
+  check(ctx, a, 2, STATUS_UNSAT);
+
+  // x > 0 alone: sat
+  check(ctx, a, 1, STATUS_SAT);
+
+  // false at the base level: the core is the assumption alone
+  a[0] = parse("(< (* x x) 1)");
+  check(ctx, a, 1, STATUS_UNSAT);
+
+  // the unsat pair is preceded and followed by other assumptions
+  a[0] = parse("(> y 0)");
+  a[1] = parse("(> x 1)");
+  a[2] = parse("(> (* x y) 10)");
+  a[3] = parse("(< y 1)");
+  check(ctx, a, 4, STATUS_UNSAT);
+  check(ctx, a, 3, STATUS_SAT);
+
+  // no assumptions
+  check(ctx, a, 0, STATUS_SAT);
+
+  // the assumptions don't survive push/pop
+  if (yices_push(ctx) < 0) print_error();
+  if (yices_assert_formula(ctx, parse("(> y 5)")) < 0) print_error();
+  check(ctx, a + 3, 1, STATUS_UNSAT);
+  if (yices_pop(ctx) < 0) print_error();
+  check(ctx, a + 3, 1, STATUS_SAT);
+
+  yices_free_context(ctx);
+  yices_exit();
+
+  return 0;
+}
+
+#else
+
+int main(void) {
+  printf("skipped: this test requires MCSAT\n");
+  return 0;
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE SIZE BOUND ON THE MODEL'S EVALUATION CACHE
+ *
+ * We evaluate more than MODEL_EVAL_CACHE_MAX distinct terms in the same
+ * model. The values must be correct and the cache must never have more
+ * than MODEL_EVAL_CACHE_MAX entries.
+ */
+
+/*
+ * Force assert to work even if compiled with debug disabled
+ */
+#ifdef NDEBUG
+# undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "model/models.h"
+
+#include "yices.h"
+
+
+#define NVARS 10
+#define NTERMS (MODEL_EVAL_CACHE_MAX + (MODEL_EVAL_CACHE_MAX/2))
+
+int main(void) {
+  term_t x[NVARS], c[NVARS];
+  model_t *mdl;
+  term_t t, a;
+  int32_t i;
+  uint32_t max_size, n;
+
+  yices_init();
+
+  for (i=0; i<NVARS; i++) {
+    x[i] = yices_new_uninterpreted_term(yices_int_type());
+    c[i] = yices_int32(i * 10);
+  }
+  mdl = yices_model_from_map(NVARS, x, c);
+  if (mdl == NULL) {
+    yices_print_error(stderr);
+    exit(1);
+  }
+
+  max_size = 0;
+  for (i=1; i<NTERMS; i++) {
+    t = yices_add(x[i % NVARS], yices_int32(i));
+    a = yices_get_value_as_term(mdl, t);
+    if (a == NULL_TERM) {
+      yices_print_error(stderr);
+      exit(1);
+    }
+    if (a != yices_int32((i % NVARS) * 10 + i)) {
+      fprintf(stderr, "BUG: wrong value for term %"PRId32"\n", i);
+      exit(1);
+    }
+
+    assert(mdl->eval_cache != NULL);
+    n = mdl->eval_cache->nelems;
+    if (n > max_size) max_size = n;
+    if (n > MODEL_EVAL_CACHE_MAX) {
+      fprintf(stderr, "BUG: eval cache has %"PRIu32" entries\n", n);
+      exit(1);
+    }
+  }
+
+  printf("%"PRId32" terms evaluated: max cache size = %"PRIu32"\n", (int32_t) (NTERMS - 1), max_size);
+
+  model_shrink_eval_cache(mdl);
+  assert(mdl->eval_cache->nelems == 0);
+  if (yices_get_value_as_term(mdl, yices_add(x[0], x[1])) != yices_int32(10)) {
+    fprintf(stderr, "BUG: evaluation failed after shrinking the cache\n");
+    exit(1);
+  }
+
+  yices_free_model(mdl);
+  yices_exit();
+
+  return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * This file is part of the Yices SMT Solver.
+ * Copyright (C) 2017 SRI International.
+ *
+ * Yices is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Yices is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Yices.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * TEST THE PER-THREAD MAGAZINES OF OBJECT STORES AND MPQ STORES
+ *
+ * This is meaningful only in THREAD_SAFE mode. We launch several waves
+ * of threads that allocate and free objects in two shared stores. More
+ * threads are created in total than there are magazines. Checks:
+ * - objects are not shared between threads
+ * - thread indices are recycled: a thread never gets an index larger
+ *   than the number of live threads
+ * - when a thread exits, its magazines are emptied
+ */
+
+/*
+ * Force assert to work even if compiled with debug disabled
+ */
+#ifdef NDEBUG
+# undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "utils/object_stores.h"
+#include "terms/mpq_stores.h"
+
+#if defined(THREAD_SAFE) && !defined(MINGW)
+
+#include <pthread.h>
+
+#include "mt/yices_locks.h"
+
+
+#define NWAVES 8
+#define NTHREADS 8
+#define NROUNDS 2000
+#define NOBJS 150
+
+static object_store_t store;
+static mpq_store_t qstore;
+
+static uint32_t max_index;
+static pthread_mutex_t max_index_lock = PTHREAD_MUTEX_INITIALIZER;
+
+
+static void *worker(void *arg) {
+  void *p[NOBJS];
+  mpq_ptr q[NOBJS];
+  uintptr_t id;
+  uint32_t r, i, k, n;
+
+  id = (uintptr_t) arg;
+
+  k = yices_thread_index();
+  pthread_mutex_lock(&max_index_lock);
+  if (k > max_index) max_index = k;
+  pthread_mutex_unlock(&max_index_lock);
+
+  for (r=0; r<NROUNDS; r++) {
+    // vary the number of objects so that the magazines are
+    // not empty when the thread exits
+    n = 1 + (r + id) % NOBJS;
+    for (i=0; i<n; i++) {
+      p[i] = objstore_alloc(&store);
+      *((uintptr_t *) p[i]) = id;
+      q[i] = mpqstore_alloc(&qstore);
+      mpq_set_ui(q[i], id, 1);
+    }
+    for (i=0; i<n; i++) {
+      if (*((uintptr_t *) p[i]) != id || mpq_cmp_ui(q[i], id, 1) != 0) {
+        fprintf(stderr, "BUG: object shared between threads\n");
+        exit(1);
+      }
+      objstore_free(&store, p[i]);
+      mpqstore_free(&qstore, q[i]);
+    }
+  }
+
+  return NULL;
+}
+
+
+int main(void) {
+  pthread_t t[NTHREADS];
+  uintptr_t id;
+  uint32_t w, i, main_index;
+  int code;
+
+  init_objstore(&store, sizeof(uintptr_t), 100);
+  init_mpqstore(&qstore);
+
+  main_index = yices_thread_index();
+  max_index = main_index;
+
+  id = 0;
+  for (w=0; w<NWAVES; w++) {
+    for (i=0; i<NTHREADS; i++) {
+      id ++;
+      code = pthread_create(t + i, NULL, worker, (void *) id);
+      if (code != 0) {
+        fprintf(stderr, "pthread_create failed: %d\n", code);
+        exit(1);
+      }
+    }
+    for (i=0; i<NTHREADS; i++) {
+      pthread_join(t[i], NULL);
+    }
+
+    for (i=0; i<OBJSTORE_MAGAZINES; i++) {
+      if (i != main_index && (store.mag[i].m.count != 0 || store.mag[i].m.list != NULL)) {
+        fprintf(stderr, "BUG: object magazine %"PRIu32" not flushed\n", i);
+        exit(1);
+      }
+    }
+    for (i=0; i<MPQSTORE_MAGAZINES; i++) {
+      if (i != main_index && (qstore.mag[i].m.count != 0 || qstore.mag[i].m.list != NULL)) {
+        fprintf(stderr, "BUG: mpq magazine %"PRIu32" not flushed\n", i);
+        exit(1);
+      }
+    }
+  }
+
+  printf("%"PRIu32" threads, max thread index = %"PRIu32"\n", (uint32_t) id, max_index);
+  if (max_index > NTHREADS) {
+    fprintf(stderr, "BUG: thread indices are not recycled\n");
+    exit(1);
+  }
+
+  delete_objstore(&store);
+  delete_mpqstore(&qstore);
+
+  return 0;
+}
+
+#else
+
+int main(void) {
+  printf("skipped: this test requires THREAD_SAFE mode\n");
+  return 0;
+}
+
+#endif